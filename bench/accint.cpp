@@ -0,0 +1,166 @@
+//! \brief Microbenchmark of the native and portable AccInt arithmetic.
+//! Times csum(), csub() and square() on AccInt<uint64_t> and AccInt<uint32_t>
+//! for the random values, validating the results against the reference
+//! double-width arithmetic of the compiler.
+//! The backend is selected at compile time, so the native (default) and the
+//! portable (ACCINT_PORTABLE) builds are compared by running both binaries,
+//! which should yield the same checksums.
+//!
+//! Build (from the repository root):
+//! 	g++ -std=c++17 -O2 -DNDEBUG -DMACRODEF_H -Iexport/shared bench/accint.cpp -o accint_native
+//! 	g++ -std=c++17 -O2 -DNDEBUG -DMACRODEF_H -DACCINT_PORTABLE -Iexport/shared bench/accint.cpp -o accint_portable
+//! Run:
+//! 	./accint_native [ops=2000000] [rounds=20]; ./accint_portable [ops=2000000] [rounds=20]
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-17
+
+#include <cstddef>  // size_t
+#include <cstdio>
+#include <cstdlib>  // strtoul
+#include <cstdint>  // uintX_t
+#include <chrono>
+#include <vector>
+#include <random>
+
+#include "arithmetic.hpp"
+
+#ifndef __SIZEOF_INT128__
+	#error "The reference 128 bit arithmetic of the compiler is required for the validation"
+#endif // __SIZEOF_INT128__
+
+using namespace daoc;
+using std::vector;
+using Clock = std::chrono::steady_clock;
+
+//! Reference unsigned 128 bit integer
+__extension__ typedef unsigned __int128  RefUInt128;
+
+//! \brief Reference double-width type of the AccInt
+template <typename UIntT>
+using RefAccUInt = std::conditional_t<sizeof(UIntT) == sizeof(uint64_t), RefUInt128, uint64_t>;
+
+//! \brief Elapsed seconds since the time point
+//!
+//! \param tstart Clock::time_point  - start time
+//! \return double  - elapsed seconds
+static double elapsed(Clock::time_point tstart)
+{
+	return std::chrono::duration<double>(Clock::now() - tstart).count();
+}
+
+//! \brief Reference value of the AccInt
+//!
+//! \param v const AccInt<UIntT>&  - the value
+//! \return RefAccUInt<UIntT>  - reference value
+template <typename UIntT>
+RefAccUInt<UIntT> reference(const AccInt<UIntT>& v) noexcept
+{
+	return static_cast<RefAccUInt<UIntT>>(v.high) << AccInt<UIntT>::hszbits | v.low;
+}
+
+//! \brief Checksum of the AccInt value
+//!
+//! \param v const AccInt<UIntT>&  - the value
+//! \return uint64_t  - checksum
+template <typename UIntT>
+uint64_t checksum(const AccInt<UIntT>& v) noexcept
+{
+	return uint64_t(v.high) * 0x9e3779b97f4a7c15ULL ^ v.low;
+}
+
+//! \brief Benchmark and validate the AccInt<UIntT> arithmetic
+//!
+//! \tparam UIntT  - half type of the AccInt
+//!
+//! \param ops size_t  - the number of operands
+//! \param rounds unsigned  - the number of timed rounds
+//! \param seed uint64_t  - random seed
+//! \return bool  - whether the results match the reference
+template <typename UIntT>
+bool evaluate(size_t ops, unsigned rounds, uint64_t seed)
+{
+	using AccT = AccInt<UIntT>;
+	using RefT = RefAccUInt<UIntT>;
+
+	std::mt19937_64  rnd(seed);
+	vector<AccT>  vals(ops);
+	for(auto& v: vals)
+		v = AccT(rnd(), rnd());
+	vector<UIntT>  sqvals(ops);
+	for(auto& v: sqvals)
+		v = rnd();
+
+	// Validation
+	bool  valid = true;
+	for(size_t i = 0; i + 1 < ops && valid; ++i) {
+		AccT  res = vals[i];
+		const RefT  a = reference(vals[i]), b = reference(vals[i + 1]);
+		const bool  carry = csum(res, vals[i + 1]);
+		valid = reference(res) == RefT(a + b) && carry == (RefT(a + b) < b);
+		res = vals[i];
+		const bool  borrow = csub(res, vals[i + 1]);
+		valid = valid && reference(res) == RefT(a - b) && borrow == (a < b);
+		valid = valid && reference(square(sqvals[i])) == RefT(sqvals[i]) * sqvals[i];
+	}
+
+	// Timing
+	uint64_t  sumchk = 0;  // Checksum of the sums
+	uint64_t  subchk = 0;  // Checksum of the differences
+	uint64_t  sqchk = 0;  // Checksum of the squares
+	auto  tstart = Clock::now();
+	for(unsigned ir = 0; ir < rounds; ++ir) {
+		AccT  sum;
+		size_t  carries = 0;
+		for(const auto& v: vals)
+			carries += csum(sum, v);
+		sumchk += checksum(sum) + carries;
+	}
+	const double  tsum = elapsed(tstart);
+	tstart = Clock::now();
+	for(unsigned ir = 0; ir < rounds; ++ir) {
+		AccT  diff;
+		size_t  borrows = 0;
+		for(const auto& v: vals)
+			borrows += csub(diff, v);
+		subchk += checksum(diff) + borrows;
+	}
+	const double  tsub = elapsed(tstart);
+	tstart = Clock::now();
+	for(unsigned ir = 0; ir < rounds; ++ir) {
+		AccT  acc;
+		for(auto v: sqvals)
+			acc ^= square(v).low ^ ir;
+		sqchk += checksum(acc);
+	}
+	const double  tsq = elapsed(tstart);
+
+	const double  nops = double(ops) * rounds;
+	printf("AccInt<uint%u_t>  csum %.2f ns, csub %.2f ns, square %.2f ns"
+		"  checksums: %#lx %#lx %#lx  %s\n", unsigned(sizeof(UIntT) * 8)
+		, tsum * 1e9 / nops, tsub * 1e9 / nops, tsq * 1e9 / nops
+		, sumchk, subchk, sqchk, valid ? "valid" : "INVALID");
+	return valid;
+}
+
+int main(int argc, char** argv)
+{
+	const size_t  ops = argc >= 2 ? strtoul(argv[1], nullptr, 10) : 2000000;
+	const unsigned  rounds = argc >= 3 ? strtoul(argv[2], nullptr, 10) : 20;
+	if(ops < 2 || !rounds) {
+		fputs("Usage: accint [ops=2000000] [rounds=20]\n", stderr);
+		return 1;
+	}
+	printf("AccInt backend: %s, operands: %lu, rounds: %u\n"
+		, ACCINT_NATIVE128 ? "native" : "portable", ops, rounds);
+	bool  valid = evaluate<uint64_t>(ops, rounds, ops);
+	valid = evaluate<uint32_t>(ops, rounds, ops + 1) && valid;
+	if(!valid)
+		fputs("ERROR, the AccInt arithmetic differs from the reference\n", stderr);
+	return !valid;
+}
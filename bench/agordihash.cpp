@@ -0,0 +1,129 @@
+//! \brief Validation and microbenchmark of the AgordiHash encryption.
+//! Validates that the encryption is a bijection: decrypt(encrypt(x)) == x for
+//! the random states of the encrypted hash size and the encrypted() results of
+//! the distinct hashes are distinct, also timing the encrypted digest.
+//!
+//! Build (from the repository root):
+//! 	g++ -std=c++17 -O2 -DNDEBUG -DMACRODEF_H -DUTEST -fno-strict-aliasing
+//! 		-Iexport/shared bench/agordihash.cpp -o agordihash
+//! Run:
+//! 	./agordihash [hashes=1000000]
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-17
+
+#include <cstddef>  // size_t
+#include <cstdio>
+#include <cstdlib>  // strtoul
+#include <cstdint>  // uintX_t
+#include <cstring>  // memcpy
+#include <chrono>
+#include <vector>
+#include <random>
+#include <algorithm>  // sort, unique, adjacent_find
+
+#include "agordihash.hpp"
+
+using namespace daoc;
+using std::vector;
+using Clock = std::chrono::steady_clock;
+using Hash = AgordiHash<>;
+
+//! \brief Elapsed seconds since the time point
+//!
+//! \param tstart Clock::time_point  - start time
+//! \return double  - elapsed seconds
+static double elapsed(Clock::time_point tstart)
+{
+	return std::chrono::duration<double>(Clock::now() - tstart).count();
+}
+
+//! \brief Validate decrypt(encrypt(x)) == x on the random states
+//!
+//! \param num size_t  - the number of states
+//! \param seed uint64_t  - random seed
+//! \return bool  - whether all states are restored
+static bool validateInverse(size_t num, uint64_t seed)
+{
+	std::mt19937_64  rnd(seed);
+	vector<uint8_t>  orig(Hash::encSize());
+	for(size_t i = 0; i < num; ++i) {
+		for(auto& b: orig)
+			b = rnd();
+		// Sparse states differing in a single bit are the most collision-prone
+		if(i % 2)
+			std::fill(orig.begin(), orig.end() - 1, 0);
+		vector<uint8_t>  data(orig);
+		Hash::encrypt(data.data(), data.size());
+		Hash::decrypt(data.data(), data.size());
+		if(data != orig)
+			return false;
+	}
+	return true;
+}
+
+//! \brief Validate that the distinct hashes have distinct encrypted representations
+//!
+//! \param num size_t  - the number of hashes
+//! \param seed uint64_t  - random seed
+//! \return bool  - whether the encrypted representations are unique
+static bool validateUnique(size_t num, uint64_t seed)
+{
+	std::mt19937_64  rnd(seed);
+	// Raw states of the small sets of the close ids, whose hashes differ in a few bits
+	// Note: the raw states are compared since the hash ordering is defined only for the same lsum
+	vector<Hash::Data>  raws;
+	raws.reserve(num);
+	for(size_t i = 0; i < num; ++i) {
+		Hash  hash;
+		const uint32_t  base = 1 + rnd() % (num / 4 + 1);
+		for(unsigned j = 1 + rnd() % 3; j--; )
+			hash.add(base + j * (1 + rnd() % 3));
+		const auto  data = reinterpret_cast<const uint8_t*>(&hash);
+		raws.emplace_back(data, data + sizeof hash);
+	}
+	std::sort(raws.begin(), raws.end());
+	raws.erase(std::unique(raws.begin(), raws.end()), raws.end());
+
+	vector<Hash::Data>  encs;
+	encs.reserve(raws.size());
+	for(const auto& raw: raws) {
+		Hash  hash;
+		memcpy(&hash, raw.data(), sizeof hash);
+		encs.push_back(hash.encrypted());
+	}
+	std::sort(encs.begin(), encs.end());
+	return std::adjacent_find(encs.begin(), encs.end()) == encs.end();
+}
+
+int main(int argc, char** argv)
+{
+	const size_t  num = argc >= 2 ? strtoul(argv[1], nullptr, 10) : 1000000;
+	if(!num) {
+		fputs("Usage: agordihash [hashes=1000000]\n", stderr);
+		return 1;
+	}
+	printf("AgordiHash<> size: %lu B, encrypted: %lu B, hashes: %lu\n"
+		, sizeof(Hash), Hash::encSize(), num);
+	const bool  inverse = validateInverse(num, num);
+	const bool  unique = validateUnique(num, num + 1);
+	printf("decrypt(encrypt(x)) == x: %s, distinct encrypted(): %s\n"
+		, inverse ? "valid" : "INVALID", unique ? "valid" : "INVALID");
+
+	Hash  hash;
+	size_t  sink = 0;
+	const auto  tstart = Clock::now();
+	for(size_t i = 0; i < num; ++i) {
+		hash.add(i + 1);
+		sink += hash.edigest();
+	}
+	printf("edigest() %.2f ns  [sink: %lu]\n", elapsed(tstart) * 1e9 / num, sink % 10);
+	if(!inverse || !unique)
+		fputs("ERROR, the AgordiHash encryption is not a bijection\n", stderr);
+	return !(inverse && unique);
+}
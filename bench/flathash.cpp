@@ -0,0 +1,159 @@
+//! \brief Microbenchmark of FlatHashMap versus std::unordered_map.
+//! Evaluates the memory consumption, insertion and lookup (50% hits) time of
+//! the uint32 -> uint32 maps on the random keys, validating the FlatHashMap
+//! content against std::unordered_map on the random insert/erase/lookup sequence.
+//!
+//! Build (glibc >= 2.33, from the repository root, xxhash/xxhash.h should be reachable by the include paths):
+//! 	g++ -std=c++17 -O2 -DNDEBUG -DMACRODEF_H -DXXH_INLINE_ALL -fno-strict-aliasing
+//! 		-Iexport/shared -I<xxhash_parent_dir> bench/flathash.cpp -o flathash
+//! Run:
+//! 	./flathash [keys=20000000]
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#include <cstdio>
+#include <cstdlib>  // strtoul
+#include <cstdint>  // uint32_t
+#include <malloc.h>  // mallinfo2
+#include <chrono>
+#include <vector>
+#include <random>
+#include <algorithm>  // min
+#include <unordered_map>
+
+#include "flathash.hpp"
+
+using namespace daoc;
+using std::vector;
+using std::unordered_map;
+using Clock = std::chrono::steady_clock;
+
+// Accounting of the allocated memory ------------------------------------------
+//! \brief The number of currently allocated bytes (glibc specific)
+//!
+//! \return size_t  - allocated bytes including the mmapped blocks
+static size_t allocated() noexcept
+{
+	const auto  mi = mallinfo2();
+	return mi.uordblks + mi.hblkhd;
+}
+
+// Benchmarking ----------------------------------------------------------------
+//! \brief Elapsed seconds since the time point
+//!
+//! \param tstart Clock::time_point  - start time
+//! \return double  - elapsed seconds
+static double elapsed(Clock::time_point tstart)
+{
+	return std::chrono::duration<double>(Clock::now() - tstart).count();
+}
+
+//! \brief Benchmark the map on the keys
+//!
+//! \tparam MapT  - map type
+//!
+//! \param name const char*  - map name
+//! \param keys const vector<uint32_t>&  - inserting keys
+//! \param queries const vector<uint32_t>&  - lookup keys
+//! \return size_t  - the number of found queries
+template <typename MapT>
+size_t benchmark(const char* name, const vector<uint32_t>& keys, const vector<uint32_t>& queries)
+{
+	const size_t  membase = allocated();
+	size_t  found = 0;
+	{
+		MapT  items;
+		auto  tstart = Clock::now();
+		for(size_t i = 0; i < keys.size(); ++i)
+			items.emplace(keys[i], i);
+		const double  tins = elapsed(tstart);
+		const size_t  mem = allocated() - membase;
+
+		tstart = Clock::now();
+		for(auto key: queries)
+			found += items.find(key) != items.end();
+		const double  tfind = elapsed(tstart);
+		printf("%-14s %4lu MB (%.1f B/entry)  insert %.2f s  lookup %.2f s\n", name
+			, mem >> 20, double(mem) / items.size(), tins, tfind);
+	}
+	return found;
+}
+
+//! \brief Validate FlatHashMap against unordered_map on the random operations
+//!
+//! \param ops size_t  - the number of operations
+//! \param seed uint64_t  - random seed
+//! \return bool  - whether the content is consistent
+static bool validate(size_t ops, uint64_t seed)
+{
+	std::mt19937_64  rnd(seed);
+	// Note: the narrow range of keys yields the frequent erasures and hits
+	std::uniform_int_distribution<uint32_t>  keydis(0, ops / 4);
+	FlatHashMap<uint32_t, uint32_t>  flat;
+	unordered_map<uint32_t, uint32_t>  ref;
+	for(size_t i = 0; i < ops; ++i) {
+		const uint32_t  key = keydis(rnd);
+		switch(rnd() % 3) {
+		case 0:
+			if(flat.emplace(key, i).second != ref.emplace(key, i).second)
+				return false;
+			break;
+		case 1:
+			if(flat.erase(key) != ref.erase(key))
+				return false;
+			break;
+		default: {
+			const auto  it = flat.find(key);
+			const auto  iref = ref.find(key);
+			if((it == flat.end()) != (iref == ref.end())
+			|| (it != flat.end() && it->second != iref->second))
+				return false;
+		}
+		}
+	}
+	if(flat.size() != ref.size())
+		return false;
+	for(const auto& el: flat) {
+		const auto  iref = ref.find(el.first);
+		if(iref == ref.end() || iref->second != el.second)
+			return false;
+	}
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	const size_t  num = argc >= 2 ? strtoul(argv[1], nullptr, 10) : 20000000;
+	if(!num) {
+		fputs("Usage: flathash [keys=20000000]\n", stderr);
+		return 1;
+	}
+	if(!validate(std::min<size_t>(num, 1000000), num)) {
+		fputs("ERROR, FlatHashMap is inconsistent with unordered_map\n", stderr);
+		return 1;
+	}
+
+	std::mt19937_64  rnd(num);
+	vector<uint32_t>  keys(num);
+	for(auto& key: keys)
+		key = rnd();
+	// Half of the queries are hits
+	vector<uint32_t>  queries(num);
+	for(size_t i = 0; i < num; ++i)
+		queries[i] = i % 2 ? keys[rnd() % num] : uint32_t(rnd());
+
+	printf("Keys: %lu, uint32 -> uint32, lookups: %lu (50%% hits)\n", num, num);
+	const size_t  fstd = benchmark<unordered_map<uint32_t, uint32_t>>("unordered_map", keys, queries);
+	const size_t  fflat = benchmark<FlatHashMap<uint32_t, uint32_t>>("FlatHashMap", keys, queries);
+	if(fstd != fflat) {
+		fprintf(stderr, "ERROR, the number of found keys differs: %lu != %lu\n", fstd, fflat);
+		return 1;
+	}
+	return 0;
+}
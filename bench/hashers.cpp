@@ -0,0 +1,166 @@
+//! \brief Microbenchmark of the SolidHash hasher policies.
+//! Evaluates XxHasher, FmixHasher and FibHasher on the dense ids, sparse ids
+//! and pointers both for the raw hashing and for the unordered_map emplace+find,
+//! validating the DefaultHasher choice for each key type. FibHasher is the
+//! cheapest one but does not avalanche the bits, so DefaultHasher chooses among
+//! XxHasher and FmixHasher by the raw hashing time, which is stable unlike the
+//! map timings dominated by the memory access.
+//!
+//! Build (from the repository root, xxhash/xxhash.h should be reachable by the include paths):
+//! 	g++ -std=c++17 -O2 -DNDEBUG -DMACRODEF_H -DXXH_INLINE_ALL -fno-strict-aliasing
+//! 		-Iexport/shared -I<xxhash_parent_dir> bench/hashers.cpp -o hashers
+//! Run:
+//! 	./hashers [keys=2000000]
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#include <cstdio>
+#include <cstdlib>  // strtoul
+#include <cstring>  // strcmp
+#include <chrono>
+#include <vector>
+#include <memory>  // unique_ptr
+#include <random>
+#include <algorithm>  // shuffle
+#include <unordered_map>
+#include <type_traits>  // is_same
+
+#include "hashing.hpp"
+
+using namespace daoc;
+using std::vector;
+using std::unordered_map;
+using Clock = std::chrono::steady_clock;
+
+constexpr unsigned  RAW_ROUNDS = 20;  //!< Rounds of the raw hashing
+constexpr unsigned  MAP_ROUNDS = 5;  //!< Rounds of the map emplace+find
+
+//! \brief Elapsed seconds since the time point
+//!
+//! \param tstart Clock::time_point  - start time
+//! \return double  - elapsed seconds
+static double elapsed(Clock::time_point tstart)
+{
+	return std::chrono::duration<double>(Clock::now() - tstart).count();
+}
+
+//! \brief Raw hashing of the keys
+//!
+//! \tparam HasherT  - hasher policy
+//! \tparam T  - key type
+//!
+//! \param keys const vector<T>&  - keys
+//! \param[out] sink size_t&  - accumulated digests to prevent the elimination
+//! \return double  - elapsed seconds
+template <typename HasherT, typename T>
+double benchRaw(const vector<T>& keys, size_t& sink)
+{
+	const SolidHash<T, HasherT>  hasher;
+	const auto  tstart = Clock::now();
+	for(unsigned ir = 0; ir < RAW_ROUNDS; ++ir)
+		for(auto key: keys)
+			sink += hasher(key);
+	return elapsed(tstart);
+}
+
+//! \brief The unordered_map emplace and find of the keys
+//!
+//! \tparam HasherT  - hasher policy
+//! \tparam T  - key type
+//!
+//! \param keys const vector<T>&  - keys
+//! \param[out] sink size_t&  - accumulated found values to prevent the elimination
+//! \return double  - elapsed seconds
+template <typename HasherT, typename T>
+double benchMap(const vector<T>& keys, size_t& sink)
+{
+	const auto  tstart = Clock::now();
+	for(unsigned ir = 0; ir < MAP_ROUNDS; ++ir) {
+		unordered_map<T, size_t, SolidHash<T, HasherT>>  items;
+		items.reserve(keys.size());
+		for(size_t i = 0; i < keys.size(); ++i)
+			items.emplace(keys[i], i);
+		for(auto key: keys)
+			sink += items.find(key)->second;
+	}
+	return elapsed(tstart);
+}
+
+//! \brief Name of the hasher policy
+//!
+//! \tparam HasherT  - hasher policy
+//! \return const char*  - name
+template <typename HasherT>
+const char* hasherName() noexcept
+{
+	return std::is_same<HasherT, XxHasher>::value ? "XxHasher"
+		: std::is_same<HasherT, FmixHasher>::value ? "FmixHasher"
+		: std::is_same<HasherT, FibHasher>::value ? "FibHasher" : "custom";
+}
+
+//! \brief Evaluate all hashers on the keys and validate the DefaultHasher choice
+//!
+//! \tparam T  - key type
+//!
+//! \param name const char*  - name of the keys set
+//! \param keys const vector<T>&  - keys
+//! \return bool  - whether DefaultHasher<T> is the fastest avalanching hasher of the keys
+template <typename T>
+bool evaluate(const char* name, const vector<T>& keys)
+{
+	size_t  sink = 0;
+	const double  rxx = benchRaw<XxHasher>(keys, sink);
+	const double  rfmix = benchRaw<FmixHasher>(keys, sink);
+	const double  rfib = benchRaw<FibHasher>(keys, sink);
+	const double  mxx = benchMap<XxHasher>(keys, sink);
+	const double  mfmix = benchMap<FmixHasher>(keys, sink);
+	const double  mfib = benchMap<FibHasher>(keys, sink);
+	const char*  fastest = rfmix <= rxx ? hasherName<FmixHasher>() : hasherName<XxHasher>();
+	printf("%-12s %.3f/%.3f/%.3f s\t%.2f/%.2f/%.2f s\t%s (measured: %s)  [sink: %lu]\n", name
+		, rxx, rfmix, rfib, mxx, mfmix, mfib, hasherName<DefaultHasher<T>>(), fastest, sink % 10);
+	return !strcmp(hasherName<DefaultHasher<T>>(), fastest);
+}
+
+int main(int argc, char** argv)
+{
+	const size_t  num = argc >= 2 ? strtoul(argv[1], nullptr, 10) : 2000000;
+	if(!num) {
+		fputs("Usage: hashers [keys=2000000]\n", stderr);
+		return 1;
+	}
+	std::mt19937_64  rnd(num);
+
+	// Dense ids in the random order
+	vector<uint32_t>  dense(num);
+	for(size_t i = 0; i < num; ++i)
+		dense[i] = i;
+	std::shuffle(dense.begin(), dense.end(), rnd);
+	// Sparse ids
+	vector<uint32_t>  sparse(num);
+	for(auto& id: sparse)
+		id = rnd();
+	// Pointers to the individually allocated items having zero lowest bits
+	vector<std::unique_ptr<uint64_t>>  items(num);
+	vector<const uint64_t*>  ptrs(num);
+	for(size_t i = 0; i < num; ++i) {
+		items[i].reset(new uint64_t(i));
+		ptrs[i] = items[i].get();
+	}
+	std::shuffle(ptrs.begin(), ptrs.end(), rnd);
+
+	printf("Keys: %lu, raw hashing rounds: %u, map emplace+find rounds: %u\n"
+		"%-12s %-20s\t%-20s\t%s\n", num, RAW_ROUNDS, MAP_ROUNDS
+		, "keys", "raw xxh/fmix/fib", "map xxh/fmix/fib", "DefaultHasher");
+	bool  valid = evaluate("dense ids", dense);
+	valid = evaluate("sparse ids", sparse) && valid;
+	valid = evaluate("pointers", ptrs) && valid;
+	if(!valid)
+		fputs("WARNING, DefaultHasher differs from the measured fastest hasher for some keys\n", stderr);
+	return !valid;
+}
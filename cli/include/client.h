@@ -14,6 +14,7 @@
 #include <chrono>  // For the execution timing
 
 #include "all.hpp"
+#include "accuracy.hpp"  // Extrinsic accuracy measures
 
 using std::unique_ptr;
 using namespace std::chrono;
@@ -29,9 +30,12 @@ private:
 	Timestamp  m_mark;  // Latest time stamp (construction or update time)
 public:
 	uint64_t  loadnet;  //!< Input network loading time
-	uint64_t  loadcls;  //!< Evaluating clusters loading time
+	uint64_t  loadcls;  //!< Evaluating clusters loading time (accumulated for multiple clusterings)
 	uint64_t  cluster;  //!< Clustering time (duration)
 	uint64_t  evaluate;  //!< Evaluation time (duration)
+	uint64_t  evalcdn;  //!< Conductance evaluation time (part of evaluate)
+	uint64_t  evalmod;  //!< Modularity evaluation time (part of evaluate)
+	uint64_t  evalgamma;  //!< Static gamma and modularity evaluation time (part of evaluate)
 	uint64_t  outpfile;  //!< Results serialization time
 	uint64_t  outpterm;  //!< Results output time to the terminal
 
@@ -44,7 +48,7 @@ public:
 	static void print(uint64_t mcsec, const char* prefix="", FILE* fout=stdout);
 
 	Timing() noexcept: m_mark(steady_clock::now()), loadnet(), loadcls(), cluster()
-		, evaluate(), outpfile(), outpterm()  {}
+		, evaluate(), evalcdn(), evalmod(), evalgamma(), outpfile(), outpterm()  {}
 
 	Timing(Timing&&)=default;
 	Timing(const Timing&)=delete;
@@ -58,6 +62,29 @@ public:
 	uint64_t update();
 };
 
+//! Evaluation results of the clustering
+struct Evaluation {
+	string  clsfile;  //!< Evaluated clustering file
+	Intrinsics  measures;  //!< Evaluated intrinsic measures
+	size_t  clusters;  //!< The number of the evaluated clusters
+	//! Modularity is affine in gamma: Q(gamma) = qintra - gamma * qexpect
+	AccWeight  qintra;  //!< Intra-cluster term of the modularity, Q(0)
+	AccWeight  qexpect;  //!< Expected (null model) term of the modularity
+	Accuracy  accuracy;  //!< Extrinsic accuracy against the ground-truth, optional
+	Timing  timing;  //!< Clusters loading and evaluation timings
+	string  error;  //!< Evaluation error, empty on success
+
+	Evaluation() noexcept: clsfile(), measures(), clusters(0), qintra(0), qexpect(0)
+		, accuracy(), timing(), error()  {}
+
+	//! \brief Modularity of the clustering on the specified resolution
+	//! \pre qintra and qexpect are evaluated
+	//!
+	//! \param gamma AccWeight  - resolution parameter, gamma >= 0
+	//! \return AccWeight  - modularity
+	AccWeight modularity(AccWeight gamma) const noexcept  { return qintra - gamma * qexpect; }
+};
+
 //!< Processing and Output Options
 struct Options {
 	//! Hierarchy output format to the terminal:
@@ -71,13 +98,16 @@ struct Options {
 	unique_ptr<NodeVecOptions>  nodevec;  //!< Node vectorization options
 #endif // FEATURE_EMBEDDINGS
 	vector<OutputOptions>  outputs;  //! Series of clustering (hierarchy) output options
+	vector<OutputOptions>  metrics;  //! Cluster metrics output options, clsfmt specifies the clusters
+	//! Binary (.npy) node vectorization output, produced along the first significant clusters output
+	NodeVecBinOptions  vecbin;
     unique_ptr<Timing>  timing;  //! Execution timing
 
 	Options() noexcept: toutfmt('n'), extoutp(false), clustering()
 #if FEATURE_EMBEDDINGS >= 1
 		, nodevec()
 #endif // FEATURE_EMBEDDINGS
-		, outputs(), timing()  {}
+		, outputs(), metrics(), vecbin(), timing()  {}
 };
 
 //! \brief Client of the clustering library.
@@ -142,6 +172,12 @@ public:
 	template <typename ParserT>
 	void execute();
 
+    //! \brief Re-output the clusters of the hierarchy snapshot (.hbs input) without
+    //! 	the clustering, only the ROOT, ALLCLS and PERLEVEL outputs are supported
+    //!
+    //! \return void
+	void reoutput();
+
     //! \brief Perform the graph (input network) clustering using input parameters
     //!
     //! \param graph Graph<WEIGHTED>&  - input graph to be processed
@@ -149,6 +185,42 @@ public:
 	template <bool WEIGHTED=true>
 	void process(Graph<WEIGHTED>& graph);
 
+    //! \brief Evaluate the clusterings specified by the outputs on the graph
+    //! \note Up to m_evaljobs clusterings are evaluated concurrently. Loading of the clusters
+    //! 	resets the graph, so each of multiple clusterings is evaluated on its own
+    //! 	in-memory replica of the graph
+    //!
+    //! \param graph Graph<WEIGHTED>&  - input graph
+    //! \return void
+	template <bool WEIGHTED>
+	void evaluate(Graph<WEIGHTED>& graph);
+
+    //! \brief Evaluate the clustering on the graph
+    //!
+    //! \param[in,out] eval Evaluation&  - evaluation of the eval.clsfile to be performed
+    //! \param graph Graph<WEIGHTED>&  - input graph
+    //! \param acceval=nullptr const AccuracyEvaluator<Id>*  - evaluator of the extrinsic
+    //! 	accuracy against the ground-truth if not nullptr
+    //! \return void
+	template <bool WEIGHTED>
+	void evaluate(Evaluation& eval, Graph<WEIGHTED>& graph
+		, const AccuracyEvaluator<Id>* acceval=nullptr) const;
+
+    //! \brief Resolution of the grid m_gammas having the max modularity
+    //! \note Q(gamma) decreases on the non-negative expected term, so the
+    //! 	grid min is typically yielded for a single clustering
+    //!
+    //! \param eval const Evaluation&  - evaluation of the clustering
+    //! \return AccWeight  - the first gamma of the max modularity
+	AccWeight argmaxGamma(const Evaluation& eval) const;
+
+    //! \brief Output the evaluations table to m_evaltab (JSON for the .json
+    //! 	extension, otherwise CSV)
+    //!
+    //! \param evals const vector<Evaluation>&  - evaluations to be outputted
+    //! \return void
+	void outputEvaluations(const vector<Evaluation>& evals) const;
+
     //! \brief Build hierarchy from the nodes and output the results
     //! 	Outputs results to stdout, stderr and corresponding files (clsfile)
 	//! \pre Node links are ordered by bsDest() and UNIQUEOptions
@@ -166,6 +238,11 @@ public:
 private:
 	InpOptions  m_inpopts;  // Input options
 	Intrinsics  m_evals;  // Whether to evaluate specified cluster file or form it
+	string  m_evaltab;  // Output table of the evaluations (.csv or .json), optional
+	unsigned  m_evaljobs;  // Max number of the clusterings evaluated concurrently
+	vector<AccWeight>  m_gammas;  // Resolution grid of the modularity curve Q(gamma) for the evaluation, optional
+	string  m_gtfile;  // Ground-truth clustering for the extrinsic accuracy evaluation, optional
+	uint8_t  m_accflags;  // Extrinsic accuracy measures to be evaluated, AccuracyFlags
 	Options  m_opts;  // Processing and output options
 	uint8_t m_showver;  // Show version of the executable: 1 - brief, 3 - full (actual only for the usage info)
 };
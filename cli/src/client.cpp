@@ -10,6 +10,7 @@
 //! \date 2014-11-02
 
 #include <cstdio>
+#include <cmath>  // pow
 #include <iostream>  // Input file processing
 #include <utility>  // make_pair, forward
 #include <limits>  //  numeric_limits
@@ -18,8 +19,15 @@
 #include <cstring>  // strchr, strerror
 #include <algorithm>  // sort(), swap(), max(), move[container items]()
 #include <cassert>  // assert
+#include <atomic>
+#include <deque>
+
+#ifdef __unix__
+#include <glob.h>  // glob
+#endif // __unix__
 
 #include "fileio.hpp"
+#include "parallel.hpp"  // parallelRanges, parallelReduce, workersNum
 #include "client.h"
 
 // NOTE: Most of the client output is prepended with '-' prefix to distinguish it
@@ -152,6 +160,117 @@ string replaceExt(string fullname, const string& newext)
 	return fullname += newext;
 }
 
+//! \brief Form file names of the per-level output: <filename_name>/<filename_name>_<LevNum>[.filename_ext]
+//! \note The directory is created if required, the compression extension is retained
+//!
+//! \param clsfile const string&  - output file name, possibly having the compression extension
+//! \param levsnum size_t  - the number of levels
+//! \return vector<string>  - file names of the levels from the bottom
+vector<string> levelFileNames(const string& clsfile, size_t levsnum)
+{
+	const string  fname = uncompressedName(clsfile);
+	const string  dir = replaceExt(fname, "");
+	const string  ext = fname.substr(dir.size()) + clsfile.substr(fname.size());
+	auto  posb = dir.rfind('/');
+	const string  fbase = dir + '/' + dir.substr(posb == string::npos ? 0 : posb + 1) + '_';
+	ensureDir(dir);
+	vector<string>  fnames;
+	fnames.reserve(levsnum);
+	for(size_t i = 0; i < levsnum; ++i)
+		fnames.push_back(fbase + std::to_string(i) + ext);
+	return fnames;
+}
+
+//! \brief Whether the output is the significant clusters output
+//!
+//! \param outopt const OutputOptions&  - output options
+//! \return bool  - the significant clusters are outputted
+bool isSignifOutp(const OutputOptions& outopt) noexcept
+{
+	switch(toClsOutFmt(outopt.clsfmt & ClsOutFmt::MASK_OUTSTRUCT)) {
+	case ClsOutFmt::SIGNIF_OWNSDIR:
+	case ClsOutFmt::SIGNIF_OWNADIR:
+	case ClsOutFmt::SIGNIF_OWNSHIER:
+	case ClsOutFmt::SIGNIF_OWNAHIER:
+	case ClsOutFmt::SIGNIF_DEFAULT:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! \brief Indexes of the hierarchy levels satisfying the custom levels output options
+//! \note Used to route the custom levels to the archive, the levels are selected
+//! 	by the number of clusters, the level index or the power of the step ratio applied
+//! 	to the bottom level size, the selected levels are thinned by the step ratio
+//! 	retaining the top margin level
+//!
+//! \param levels const LevelsT&  - hierarchy levels starting from the bottom
+//! \param outopt const OutputOptions&  - output options of the CUSTLEVS[_APPROXNUM] structure
+//! \return vector<LevelNum>  - ascending indexes of the selected levels from the bottom
+template <typename LevelsT>
+vector<LevelNum> custLevels(const LevelsT& levels, const OutputOptions& outopt)
+{
+	const auto&  clo = outopt.custlevs;
+	vector<LevelNum>  ilevs;
+	LevelNum  levi = 0;
+	if(toClsOutFmt(outopt.clsfmt & ClsOutFmt::MASK_OUTSTRUCT) == ClsOutFmt::CUSTLEVS_APPROXNUM) {
+		// The closest levels having not less and not more than margmin clusters
+		LevelNum  ihigher = LEVEL_NONE;  // The highest level having >= margmin clusters
+		LevelNum  ilower = LEVEL_NONE;  // The lowest level having <= margmin clusters
+		for(const auto& lev: levels) {
+			if(lev.fullsize >= clo.margmin)
+				ihigher = levi;
+			if(lev.fullsize <= clo.margmin && ilower == LEVEL_NONE)
+				ilower = levi;
+			++levi;
+		}
+		if(ihigher != LEVEL_NONE)
+			ilevs.push_back(ihigher);
+		if(ilower != LEVEL_NONE && ilower != ihigher)
+			ilevs.push_back(ilower);
+		return ilevs;
+	}
+
+	if(levels.empty())
+		return ilevs;
+	const auto  botsize = levels.front().fullsize;
+	const Id  margmax = clo.margmax;  // Note: ID_NONE means unlimited
+	Id  levsel = 0;  // The number of levels satisfying the margins
+	double  lsizeMarg = 0;  // Max size of the following selected level considering the step ratio
+	for(const auto& lev: levels) {
+		bool  fit = false;  // The level satisfies the margins
+		switch(clo.levmarg) {
+		case LevMargKind::LEVID:
+			fit = levi >= clo.margmin && (margmax == ID_NONE || levi <= margmax);
+			break;
+		case LevMargKind::LEVSTEPNUM:
+			fit = clo.clsrstep > 0 && lev.fullsize <= botsize * pow(clo.clsrstep, clo.margmin)
+				&& (margmax == ID_NONE || lev.fullsize >= botsize * pow(clo.clsrstep, margmax));
+			break;
+		case LevMargKind::CLSNUM:
+			fit = lev.fullsize >= clo.margmin && (margmax == ID_NONE || lev.fullsize <= margmax);
+			break;
+		case LevMargKind::NONE:
+		default:
+			fit = true;
+		}
+		if(fit) {
+			// Thin the levels by the step ratio, where 0 means skip this parameter
+			if(ilevs.empty() || !clo.clsrstep || lev.fullsize <= lsizeMarg) {
+				ilevs.push_back(levi);
+				lsizeMarg = lev.fullsize * clo.clsrstep;
+			}
+			levsel = levi + 1;
+		}
+		++levi;
+	}
+	// Retain the top margin level
+	if(levsel && ilevs.back() != levsel - 1)
+		ilevs.push_back(levsel - 1);
+	return ilevs;
+}
+
 //! \brief Form output file name from the input file name
 //!
 //! \param outopt const OutputOptions&  - output options to be encoded in the output name
@@ -282,6 +401,35 @@ void classifyArgs(int argc, char* argv[], vector<string>& opts, vector<string>&
 #endif // VALIDATE
 }
 
+// File names helpers ---------------------------------------------------------
+//! \brief Expand the wildcard pattern of the file names
+//! \note The pattern is returned as is if it does not contain the wildcards
+//! 	or the globbing is not supported by the platform
+//!
+//! \param pattern const string&  - file name or the wildcard pattern
+//! \return vector<string>  - matching file names ordered alphabetically
+vector<string> expandFiles(const string& pattern)
+{
+	vector<string>  files;
+#ifdef __unix__
+	if(pattern.find_first_of("*?[") != string::npos) {
+		glob_t  gl;
+		const int  res = glob(pattern.c_str(), 0, nullptr, &gl);
+		if(!res)
+			files.assign(gl.gl_pathv, gl.gl_pathv + gl.gl_pathc);
+		globfree(&gl);
+		if(res == GLOB_NOMATCH)
+			throw invalid_argument("No files match the pattern: " + pattern + "\n");
+		if(res)
+			throw std::ios_base::failure("ERROR expandFiles(), the pattern expansion failed: "
+				+ pattern + "\n");
+		return files;
+	}
+#endif // __unix__
+	files.push_back(pattern);
+	return files;
+}
+
 // Timing implementation -----------------------------------------------------
 void Timing::print(uint64_t mcsec, const char* prefix, FILE* fout)
 {
@@ -300,7 +448,9 @@ uint64_t Timing::update()
 }
 
 // Client implementation ------------------------------------------------------
-Client::Client() noexcept: m_inpopts(), m_evals(), m_opts(), m_showver(0)
+Client::Client() noexcept: m_inpopts(), m_evals(), m_evaltab(), m_evaljobs(1), m_gammas()
+	, m_gtfile(), m_accflags(ACC_NONE)
+	, m_opts(), m_showver(0)
 {
 #if TRACE >= 2
 	fprintf(ftrace, "Revision: %s.%s\n= Lib Version =\n%s", libBuild().rev().c_str()
@@ -329,7 +479,27 @@ void Client::processNodes(Nodes<LinksT>& nodes, bool edges, const Options& opts,
 	}
 	fprintf(ftrace, "\n");
 #endif // TRACE
-	auto hier = cluster(nodes, edges, opts.clustering);
+	// Validate the node links in parallel, so the sequential validation is skipped on clustering
+	const ClusterOptions*  clsopts = &opts.clustering;
+	ClusterOptions  vldopts;  // Clustering options with the performed validation
+	if(opts.clustering.validation != Validation::NONE) {
+		// Note: the totals are evaluated by the clustering, the deltas are omitted here
+		AccWeight  weight = 0;
+		Size  linksNum = 0;
+		const bool  severe = opts.clustering.validation == Validation::SEVERE;
+		const Size  fixed = edges ? validateLinks<false>(nodes, weight, linksNum, severe)
+			: validateLinks<true>(nodes, weight, linksNum, severe);
+#if TRACE >= 1
+		if(fixed)
+			fprintf(ftrace, "-processNodes(), the fixed links: %lu\n", static_cast<size_t>(fixed));
+#else
+		(void)fixed;
+#endif // TRACE
+		vldopts = opts.clustering;
+		vldopts.validation = Validation::NONE;
+		clsopts = &vldopts;
+	}
+	auto hier = cluster(nodes, edges, *clsopts);
 	// Measure the clustering time
 	if(opts.timing)
 		opts.timing->cluster = opts.timing->update();
@@ -348,7 +518,113 @@ void Client::processNodes(Nodes<LinksT>& nodes, bool edges, const Options& opts,
 		return;
 	}
 
-	hier->output(opts.outputs);
+	// Note: the binary hierarchy snapshot, the levels archive, the binary membership and
+	// the compressed outputs are produced here, the remaining outputs by the library
+	auto isSnapshot = [](const OutputOptions& outopt) noexcept -> bool {
+		return isset(outopt.clsfmt, ClsOutFmt::HIER)
+			&& hasExtension(uncompressedName(outopt.clsfile), FileExts::HBS);
+	};
+	auto isArchive = [](const OutputOptions& outopt) noexcept -> bool {
+		switch(toClsOutFmt(outopt.clsfmt & ClsOutFmt::MASK_OUTSTRUCT)) {
+		case ClsOutFmt::PERLEVEL:
+		case ClsOutFmt::CUSTLEVS:
+		case ClsOutFmt::CUSTLEVS_APPROXNUM:
+			return hasExtension(uncompressedName(outopt.clsfile), FileExts::CNLA);
+		default:
+			return false;
+		}
+	};
+	auto isBinary = [](const OutputOptions& outopt) noexcept -> bool {
+		const auto  outfmt = toClsOutFmt(outopt.clsfmt & ClsOutFmt::MASK_OUTSTRUCT);
+		return (outfmt == ClsOutFmt::ROOT || outfmt == ClsOutFmt::ALLCLS)
+			&& hasExtension(uncompressedName(outopt.clsfile), FileExts::CNB);
+	};
+	auto isCompressed = [](const OutputOptions& outopt) noexcept -> bool {
+		return outpCodec(outopt.clsfile) != Codec::NONE;
+	};
+	// Note: the binary node vectorization is produced along the first significant clusters output
+	const OutputOptions*  vecoutp = nullptr;
+	if(opts.vecbin.format != NodeVecBinFmt::NONE) {
+		const auto  iout = std::find_if(opts.outputs.begin(), opts.outputs.end(), isSignifOutp);
+		if(iout != opts.outputs.end())
+			vecoutp = &*iout;
+	}
+	auto isClientOutp = [&](const OutputOptions& outopt) noexcept -> bool {
+		return isSnapshot(outopt) || isArchive(outopt) || isBinary(outopt) || isCompressed(outopt)
+			|| &outopt == vecoutp;
+	};
+	if(std::any_of(opts.outputs.begin(), opts.outputs.end(), isClientOutp)) {
+		vector<OutputOptions>  outputs;
+		outputs.reserve(opts.outputs.size());
+		for(const auto& outopt: opts.outputs) {
+			if(!isClientOutp(outopt)) {
+				outputs.push_back(outopt);
+				continue;
+			}
+			std::deque<CompressedFile>  cfiles;  // Output files, compressed on the fly if required
+			FileWrappers  fouts;  // Non-owning views of the cfiles for the printers
+			//! Create the output file
+			auto create = [&cfiles, &fouts](const string& fname) {
+				cfiles.emplace_back(fname, outpCodec(fname));
+				fouts.emplace_back(static_cast<FILE*>(cfiles.back().file()), false);
+			};
+			const auto  outfmt = toClsOutFmt(outopt.clsfmt & ClsOutFmt::MASK_OUTSTRUCT);
+			if(isArchive(outopt)) {
+				// Custom levels of the archive
+				const bool  custlevs = outfmt != ClsOutFmt::PERLEVEL;
+				const auto  ilevs = custlevs ? custLevels(hier->levels(), outopt) : vector<LevelNum>();
+				if(custlevs && ilevs.empty()) {
+#if TRACE >= 1
+					fprintf(ftrace, "-WARNING processNodes(), no hierarchy levels satisfy the custom levels"
+						" of the archive: %s\n", outopt.clsfile.c_str());
+#endif // TRACE
+					continue;
+				}
+				create(outopt.clsfile);
+				CnlPrinter<LinksT>(*hier).archive(fouts.front(), outopt.clsfmt, outopt.fltMembers, ilevs);
+			} else if(isBinary(outopt)) {
+				create(outopt.clsfile);
+				CnlPrinter<LinksT>(*hier).binary(fouts.front(), outopt.clsfmt, outopt.fltMembers);
+			} else if(isSnapshot(outopt)) {
+				create(outopt.clsfile);
+				HbsPrinter<LinksT>(*hier).output(fouts.front());
+			} else if(isset(outopt.clsfmt, ClsOutFmt::HIER)) {
+				create(outopt.clsfile);
+				RhbPrinter<LinksT>(*hier).output(fouts.front());
+			} else {
+				// Clusters in the CNL format
+				if(outfmt == ClsOutFmt::PERLEVEL) {
+					const auto  fnames = levelFileNames(outopt.clsfile, hier->levels().size());
+					for(const auto& fname: fnames)
+						create(fname);
+				} else create(outopt.clsfile);
+				FileWrapper  fvec;  // Note: the textual vectorization is not produced
+				NodeVecCoreOptions  nvo;
+				if(&outopt == vecoutp) {
+					nvo.value = opts.vecbin.value;
+					nvo.valmin = opts.vecbin.valmin;
+					NodeVecBinWriter  fvecbin(opts.vecbin.basename, opts.vecbin.format, nvo.value, nvo.valmin);
+					CnlPrinter<LinksT>(*hier).output(fvec, nvo, fouts, outopt.clsfmt, outopt.fltMembers
+						, 0, LEVEL_NONE, 1, &outopt.signifcls, &fvecbin);
+				} else CnlPrinter<LinksT>(*hier).output(fvec, nvo, fouts, outopt.clsfmt, outopt.fltMembers
+					, 0, LEVEL_NONE, 1, &outopt.signifcls);
+			}
+			fouts.clear();
+			for(auto& cf: cfiles)
+				cf.close();
+		}
+		if(!outputs.empty())
+			hier->output(outputs);
+	} else hier->output(opts.outputs);
+	// Output the cluster metrics
+	for(const auto& outopt: opts.metrics) {
+		const bool  binary = hasExtension(outopt.clsfile, FileExts::CMB);
+		FileWrapper  fout(fopen(outopt.clsfile.c_str(), binary ? "wb" : "w"));
+		if(!fout)
+			throw std::ios_base::failure(string("ERROR processNodes(), the output file can't be created: ")
+				.append(outopt.clsfile) += '\n');
+		CnlPrinter<LinksT>(*hier).metrics(fout, outopt.clsfmt, binary);
+	}
 	// Measure the file output time
 	if(opts.timing)
 		opts.timing->outpfile = opts.timing->update();
@@ -723,16 +999,42 @@ bool Client::parseArgs(int argc, char *argv[])
 			//fprintf(ftrace, "fmt: %#x, file: %s\n", outopt.clsfmt, outopt.clsfile.c_str());
 			m_opts.outputs.push_back(move(outopt));
 		} break;
+#if OPT_CX_
+		case 'M': {  // [{r,a,l}]=<filename>
+			OutputOptions  outopt;
+			size_t  iop = 1;
+			switch(opt.length() > iop ? opt[iop] : 0) {
+			case 'r':
+				outopt.clsfmt |= ClsOutFmt::ROOT;
+				++iop;
+				break;
+			case 'l':
+				outopt.clsfmt |= ClsOutFmt::PERLEVEL;
+				++iop;
+				break;
+			case 'a':
+				++iop;
+				// Fall through
+			case '=':
+				outopt.clsfmt |= ClsOutFmt::ALLCLS;
+				break;
+			default:
+				throw invalid_argument("Unexpected option.M is provided: -" + opt + "\n");
+			}
+			if(opt.length() <= iop + 1 || opt[iop] != '=')
+				throw invalid_argument("The filename is not specified in: -" + opt + "\n");
+			outopt.clsfile = opt.substr(iop + 1);
+			m_opts.metrics.push_back(move(outopt));
+		} break;
+#endif // OPT_CX_
 #if OPT_E_
 		case 'e': {
 			// Check that it is not used with the clusters output
-			if(clsoutp || !m_opts.outputs.empty())
+			if(clsoutp || (!m_opts.outputs.empty() && !m_evals))
 				throw invalid_argument("Clusters evaluation option (-e) is not compatible with"
-					" the clusters output option (-c) and only one evaluation option is expected\n");
+					" the clusters output option (-c)\n");
 
 			// The filename is mandatory
-			OutputOptions  outopt;
-			outopt.clsfile.clear();
 			size_t  iop = opt.find('=', 1);  // Index of the filename with '=' prefix
 			if(iop == string::npos
 			|| (opt.length() == iop+2 && opt[iop+1] == '.')
@@ -759,7 +1061,7 @@ bool Client::parseArgs(int argc, char *argv[])
 					default:
 						throw invalid_argument("Invalid IntrinsicsFlags in: -" + opt + "\n");
 					}
-			} else m_evals.flags = IntrinsicsFlags::ALL;
+			} else m_evals.flags |= IntrinsicsFlags::ALL;
 
 			// Process the filename: consider quotes and skip them, skip '='
 			if(opt[iop++] != '=' || opt.length() <= iop)
@@ -772,13 +1074,99 @@ bool Client::parseArgs(int argc, char *argv[])
 				++iop;
 				opt.pop_back();
 			}
-			outopt.clsfile = opt.erase(0, iop);
-			m_opts.outputs.push_back(move(outopt));
+			// Note: each matching file of the wildcard pattern is evaluated
+			for(auto& clsfile: expandFiles(opt.erase(0, iop))) {
+				OutputOptions  outopt;
+				outopt.clsfile = move(clsfile);
+				m_opts.outputs.push_back(move(outopt));
+			}
 #if TRACE >= 3
 			fprintf(ftrace, "parseArgs(), evals flags: %s, outputs (%lu): %s, opt: %s\n", to_string(m_evals.flags).c_str()
 				, m_opts.outputs.size(), m_opts.outputs.front().clsfile.c_str(), opt.c_str());
 #endif // TRACE
 		} break;
+		case 'E': {
+			// Process the filename: consider quotes and skip them, skip '='
+			if(opt.length() <= 2 || opt[1] != '=')
+				throw invalid_argument("Unexpected option.E is provided: -" + opt + "\n");
+			size_t  iop = 2;
+			const bool  quoted = (opt[iop] == '"' && opt.back() == '"')
+				|| (opt[iop] == '\'' && opt.back() == '\'');
+			if(quoted) {
+				if(opt.length() <= iop + 2)
+					throw invalid_argument("The filename is not specified in: -" + opt + "\n");
+				++iop;
+				opt.pop_back();
+			}
+			m_evaltab = opt.erase(0, iop);
+		} break;
+		case 'j': {
+			if(opt.length() <= 2 || opt[1] != '=')
+				throw invalid_argument("Unexpected option.j is provided: -" + opt + "\n");
+			const long  jobs = strtol(&opt.c_str()[2], nullptr, 10);
+			if(jobs <= 0 || jobs > numeric_limits<uint16_t>::max())
+				throw out_of_range("The value is out of range: -" + opt + "\n");
+			m_evaljobs = jobs;
+		} break;
+		case 'G': {  // =<gamma_min>:<gamma_max>[/<points>]
+			if(opt.length() <= 2 || opt[1] != '=')
+				throw invalid_argument("Unexpected option.G is provided: -" + opt + "\n");
+			const char*  bval = opt.c_str() + 2;
+			char*  eval;
+			const AccWeight  gmin = strtod(bval, &eval);
+			if(eval == bval || *eval != ':')
+				throw invalid_argument("Unexpected option.G is provided: -" + opt + "\n");
+			bval = eval + 1;
+			const AccWeight  gmax = strtod(bval, &eval);
+			if(eval == bval || gmin < 0 || gmax < gmin)
+				throw invalid_argument("Invalid range (0 <= gamma_min <= gamma_max), option.G: -" + opt + "\n");
+			unsigned long  points = 11;  // The number of points in the grid
+			if(*eval == '/') {
+				bval = eval + 1;
+				points = strtoul(bval, &eval, 10);
+				if(eval == bval || points < 2 || points > numeric_limits<uint16_t>::max())
+					throw out_of_range("The number of points is out of range [2, 65535], option.G: -" + opt + "\n");
+			}
+			if(*eval)
+				throw invalid_argument("Unexpected option.G is provided: -" + opt + "\n");
+			m_gammas.clear();
+			m_gammas.reserve(points);
+			for(unsigned long i = 0; i < points; ++i)
+				m_gammas.push_back(gmin + (gmax - gmin) * i / (points - 1));
+		} break;
+		case 'T': {  // {f,n,o}*=<ground_truth>
+			size_t  iop = opt.find('=', 1);  // Index of the filename with '=' prefix
+			if(iop == string::npos || opt.length() <= iop + 1)
+				throw invalid_argument("The filename is not specified in: -" + opt + "\n");
+			m_accflags = ACC_NONE;
+			for(size_t i = 1; i < iop; ++i)
+				switch(opt[i]) {
+				case 'f':
+					m_accflags |= ACC_F1;
+					break;
+				case 'n':
+					m_accflags |= ACC_ONMI;
+					break;
+				case 'o':
+					m_accflags |= ACC_OMEGA;
+					break;
+				default:
+					throw invalid_argument("Invalid accuracy measure in: -" + opt + "\n");
+				}
+			if(!m_accflags)
+				m_accflags = ACC_ALL;
+			// Process the filename: consider quotes and skip them, skip '='
+			++iop;
+			const bool  quoted = (opt[iop] == '"' && opt.back() == '"')
+				|| (opt[iop] == '\'' && opt.back() == '\'');
+			if(quoted) {
+				if(opt.length() <= iop + 2)
+					throw invalid_argument("The filename is not specified in: -" + opt + "\n");
+				++iop;
+				opt.pop_back();
+			}
+			m_gtfile = opt.erase(0, iop);
+		} break;
 #endif  // OPT_E_
 		case 'a':
 			if(opt.length() >= 2)
@@ -1011,7 +1399,8 @@ bool Client::parseArgs(int argc, char *argv[])
 			m_opts.clustering.modtrace = true;
 			break;
 		case 'n':
-			if(opt.length() < 2 || opt.length() >= 3)
+			if(opt.length() < 2 || opt.length() > 3 || (opt.length() == 3
+			&& (opt[1] != 'e' || opt[2] != 'm')))
 				throw invalid_argument("Unexpected option.n is provided: -" + opt + "\n");
 			switch(opt[1]) {
 			case 'r':
@@ -1019,6 +1408,7 @@ bool Client::parseArgs(int argc, char *argv[])
 				break;
 			case 'e':
 				m_inpopts.format = FileFormat::NSE;
+				m_inpopts.mirrored = opt.length() == 3;
 				break;
 			case 'a':
 				m_inpopts.format = FileFormat::NSA;
@@ -1027,6 +1417,50 @@ bool Client::parseArgs(int argc, char *argv[])
 				throw invalid_argument("Unexpected option.d1 is provided: -" + opt + "\n");
 			}
 			break;
+		case 'v': {  // {d,s}[{b,1,2,f}][/<valmin>]=<basename>
+			const auto  iop = opt.find('=');
+			if(iop == string::npos || iop + 1 == opt.length() || iop < 2)
+				throw invalid_argument("Unexpected option.v is provided: -" + opt + "\n");
+			switch(opt[1]) {
+			case 'd':
+				m_opts.vecbin.format = NodeVecBinFmt::DENSE;
+				break;
+			case 's':
+				m_opts.vecbin.format = NodeVecBinFmt::SPARSE;
+				break;
+			default:
+				throw invalid_argument("Unexpected option.v suboption is provided: -" + opt + "\n");
+			}
+			size_t  pos = 2;  // Position of the value suboption
+			if(pos < iop && opt[pos] != '/') {
+				switch(opt[pos++]) {
+				case 'b':
+					m_opts.vecbin.value = NodeVecFmtVal::BIT;
+					break;
+				case '1':
+					m_opts.vecbin.value = NodeVecFmtVal::UINT8;
+					break;
+				case '2':
+					m_opts.vecbin.value = NodeVecFmtVal::UINT16;
+					break;
+				case 'f':
+					m_opts.vecbin.value = NodeVecFmtVal::FLOAT32;
+					break;
+				default:
+					throw invalid_argument("Unexpected option.v value format is provided: -" + opt + "\n");
+				}
+			}
+			if(pos < iop) {
+				if(opt[pos] != '/' || ++pos == iop)
+					throw invalid_argument("Unexpected option.v valmin is provided: -" + opt + "\n");
+				char*  end = nullptr;
+				const auto  valmin = strtof(opt.c_str() + pos, &end);
+				if(end != opt.c_str() + iop || valmin < 0 || valmin >= 1)
+					throw invalid_argument("The option.v valmin should be E [0, 1): -" + opt + "\n");
+				m_opts.vecbin.valmin = valmin;
+			}
+			m_opts.vecbin.basename = opt.substr(iop + 1);
+		} break;
 		case 'h':
 			if(opt.length() > 1)
 				throw invalid_argument("Unexpected option.h is provided: -" + opt + "\n");
@@ -1042,9 +1476,29 @@ bool Client::parseArgs(int argc, char *argv[])
 	}
 
 	// Check files
-	// Note: currently only the first file is accepted and processed
 	if(m_evals && m_opts.outputs.front().clsfile.empty())
 		throw invalid_argument("Evaluation file name is expected to be provided\n");
+	if(!m_evaltab.empty() && !m_evals)
+		throw invalid_argument("The evaluations table (-E) requires the evaluation option (-e)\n");
+	if(!m_gammas.empty() && !m_evals)
+		throw invalid_argument("The modularity curve (-G) requires the evaluation option (-e)\n");
+	if(!m_gtfile.empty() && !m_evals)
+		throw invalid_argument("The accuracy evaluation (-T) requires the evaluation option (-e)\n");
+	if(!m_opts.metrics.empty() && m_evals)
+		throw invalid_argument("The cluster metrics output (-M) is not compatible with the evaluation option (-e)\n");
+	for(const auto& outopt: m_opts.outputs) {
+		if(outpCodec(outopt.clsfile) == Codec::NONE)
+			continue;
+		const auto  outfmt = toClsOutFmt(outopt.clsfmt & ClsOutFmt::MASK_OUTSTRUCT);
+		if((outfmt == ClsOutFmt::CUSTLEVS || outfmt == ClsOutFmt::CUSTLEVS_APPROXNUM)
+		&& !hasExtension(uncompressedName(outopt.clsfile), FileExts::CNLA))
+			throw invalid_argument("The compressed custom levels are supported only in the archive (.cnla): "
+				+ outopt.clsfile + "\n");
+	}
+	if(m_opts.vecbin.format != NodeVecBinFmt::NONE && std::none_of(m_opts.outputs.begin()
+	, m_opts.outputs.end(), isSignifOutp))
+		throw invalid_argument("The binary node vectorization (-v) requires the significant"
+			" clusters output (-cs or -cS)\n");
 	// Note: only one input network at a time is supported currently
 	if(files.size() == 1) {  // !files.empty()
 		m_inpopts.filename = files.front();
@@ -1087,8 +1541,12 @@ void Client::info(const char filename[]) const
 #endif // OPT_CX_
 			"[=<filename>]"
 #if OPT_E_
-			" | -e{c,m,g}*=<filename>]"
+			" | -e{c,m,g}*=<filename>... [-E=<table>] [-j=<jobs>] [-G=<gamma_min>:<gamma_max>[/<points>]]"
+			" [-T{f,n,o}*=<ground_truth>]]"
 #endif  // OPT_E_
+#if OPT_CX_
+			" [-M[{r,a,l}]=<filename>]"
+#endif // OPT_CX_
 			" [-a] [-g=<resolution> | -gr[<step_ratio>][:[<step_ratio_max>]][=[<gamma_min>][:gamma_max]]]"
 			" [-b[s][p][{u,d}][=<root_szmax>]]"
 #if OPT_R_
@@ -1099,7 +1557,7 @@ void Client::info(const char filename[]) const
 			" [-f=<filter_margin>]"
 #endif // NOPREFILTER
 			" [-t] [-s] [-x{a}] [-m[s]=<gain_margmin>]"
-			" [-i] [-n{r,e,a}] <input_network> | -V[x] | [-h]\n"
+			" [-i] [-n{r,e[m],a}] [-v{d,s}=<basename>] <input_network> | -V[x] | [-h]\n"
 			"\n"
 			"Examples:\n  "
 #if OPT_CX_
@@ -1150,6 +1608,8 @@ void Client::info(const char filename[]) const
 //			" filename with the substituted '.rhb' extension."
 			" The output levels are indexed from the bottom (the most fine-grained level) having index 0"
 			" to the top (root, the most coarse-grained level) having the maximal index."
+			" The output is compressed on the fly if the <filename> has the .gz or .zst extension"
+			" (e.g. .cnl.zst, .rhb.gz), except the custom levels output to the directory."
 			" Default: omitted, format: e, filename (outputted to the input directory): "
 				<< OutputOptions::CLSFILEDFLT << endl <<
 			"    f  - filter out cluster members (nodes) having set the highest bit in the id from the"
@@ -1209,11 +1669,15 @@ void Client::info(const char filename[]) const
 			"[%#3:/0.368]  - output cluster levels staring from one having <= 0.368^3 clusters of the number"
 			" of clusters on the bottom level and up to the root level, skipping the levels having more than"
 			" <clsnum_prev> * 0.368 clusters.\n"
-			"      - output clusters from each hierarchy level when the condition is not specified\n"
+			"      - output clusters from each hierarchy level when the condition is not specified."
+			" All (or the conditioned) levels are outputted to the single indexed archive instead of"
+			" the directory if the <filename> has the .cnla extension\n"
 			"    aX  - output all distinct clusters (once for all levels even if"
 			" the cluster is propagated, flatter the hierarchy) to the <filename>,"
 			" creating the non-existing parent dirs\n"
 #endif // OPT_CX_
+			"    The root (r) and all distinct (a) clusters are outputted in the binary membership"
+			" format loadable without the parsing if the <filename> has the .cnb extension\n"
 			"    Clusters output format:\n"
 			"    Xp  - pure space separated (simple and without the header):  <node1> <node2> ...\n"
 			"    Xs  - simple space separated: <node1> <node2> ...\n"
@@ -1222,11 +1686,22 @@ void Client::info(const char filename[]) const
 			"  <cluster1>> <node1>[:<share1>] <node2>[:<share2>] ...\n"
 #if OPT_CX_
 			"    h  - output all the hierarchy to the <filename_name> in the rhb (rcg-like) format"
-			" starting from the nodes and bottom levels and listing the shares\n"
+			" starting from the nodes and bottom levels and listing the shares."
+			" The mmap-able binary hierarchy snapshot is produced instead if the <filename>"
+			" has the .hbs extension\n"
+			"  -M[{r,a,l}]=<filename>  - output quality metrics of the clusters: size, internal weight,"
+			" cut weight, density and conductance keyed by the level and cluster id. The columnar"
+			" binary is produced if the <filename> has the .cmb extension, otherwise CSV\n"
+			"    r  - root level clusters\n"
+			"    a  - all unique clusters of the hierarchy excluding the node wrappers (default)\n"
+			"    l  - clusters of each level including the propagated ones\n"
 #endif // OPT_CX_
 #if OPT_E_
 			"  -e{c,m,g}*=<filename>  - evaluate intrinsic measure(s) for the specified nodes-clusters"
-			" membership file without the clustering.\n"
+			" membership file without the clustering. The .cnb file is loaded as the binary membership."
+			" The option can be repeated and the <filename> can be a wildcard pattern (quote it: -e='res/*.cnl')"
+			" to evaluate multiple clusterings on the input network loaded once. The measures of all"
+			" options are evaluated for each file.\n"
 			"Multiple suboptions can be specified: -emc."
 			" Default: perform all evaluations\n"
 			"    c  - conductance\n"
@@ -1243,6 +1718,19 @@ void Client::info(const char filename[]) const
 			" corresponds to the root level of the hierarchy, overlaps are allowed\n"
 			"- node shares are optional for the crisp overlaps (if the node is equally"
 			" shared between all owner clusters)\n"
+			"  -E=<table>  - output the evaluations of all clusterings to the <table> file: JSON"
+			" for the .json extension, otherwise CSV\n"
+			"  -j=<jobs>  - max number of the clusterings evaluated concurrently, each job holds own"
+			" in-memory replica of the input network loaded once. Default: 1\n"
+			"  -G=<gamma_min>:<gamma_max>[/<points>]  - evaluate the modularity curve Q(gamma) on the uniform"
+			" grid of <points> resolution values (default: 11) and its argmax gamma. Modularity is affine in"
+			" gamma, so the curve is obtained from the intra-cluster and expected terms accumulated in a single pass\n"
+			"  -T{f,n,o}*=<ground_truth>  - evaluate extrinsic accuracy of each clustering against the"
+			" <ground_truth> clustering (.cnl or .cnb), which is loaded and indexed once."
+			" The node base is the union of the nodes of both clusterings. Default: all measures\n"
+			"    f  - mean F1: harmonic mean of the average best-matching F1 of the clusters of each clustering\n"
+			"    n  - overlapping NMI (NMI_max variant of the LFK NMI)\n"
+			"    o  - Omega index (the overlapping variant of the Adjusted Rand Index)\n"
 			"  -a  - accumulate weights of the duplicated links on graph construction"
 			" (applicable only for the weighted graphs/networks), otherwise skip the duplicates\n"
 			"  -g=<resolution> | -gr[<step_ratio>][:[<step_ratio_max>]][=[<gamma_min>][:gamma_max]]  - resolution parameter gamma\n"
@@ -1306,12 +1794,27 @@ void Client::info(const char filename[]) const
 			"    s  - divide the value by sqrt(numlinks), recommended: 0.01\n"
 			// Note: -i is actual only for the RELEASE build, the tracing is always performed for the debug
 			"  -i  - informative tracing, output optimization function (modularity) for each clustering iteration\n"
-			"  -n{r,e,a}  - format of the input network (graph). Default: " << to_string(m_inpopts.format) << endl <<
+			"  -n{r,e[m],a}  - format of the input network (graph). Default: " << to_string(m_inpopts.format) << endl <<
 			"    r  - readable compact graph (RCG), former hig\n"
 			"    e  - network specified by edges (NSE), compatible with: ncol, Link List, [Weighted] Edge Graph and SNAP network formats\n"
+			"      m  - mirrored listing, each edge is listed in both directions (u v and v u), so the edges"
+			" having src id > dst id are skipped on loading. ATTENTION: an edge listed only this way is lost\n"
 			"    a  - network specified by arcs (NSA)\n"
+			"  -v{d,s}[{b,1,2,f}][/<valmin>]=<basename>  - output the binary node vectorization (NumPy .npy arrays) along"
+			" the first significant clusters output (-cs or -cS), the dimensions are the outputted clusters:"
+			" <basename>.ids.npy holds the node ids of the matrix columns, <basename>.diminfo.npy"
+			" the dimensions info\n"
+			"    d  - dense matrix (dimensions x nodes): <basename>.npy\n"
+			"    s  - sparse CSR matrix: <basename>.indptr.npy, <basename>.indices.npy, <basename>.values.npy\n"
+			"    Value format of the node projections. Default: " << to_string(m_opts.vecbin.value) << endl <<
+			"      b  - bit, the projection is present (>= valmin)\n"
+			"      1  - uint8 quantization of the projection\n"
+			"      2  - uint16 quantization of the projection\n"
+			"      f  - float32 projection\n"
+			"    /<valmin>  - min outputting value of the node projection E [0, 1). Default: " << m_opts.vecbin.valmin << endl <<
 			"  <input_network>  -  input network / graph (similarity / adjacency matrix) to be processed,"
-			" specified in the .rcg (former .hig) or nsl format\n"
+			" specified in the .rcg (former .hig) or nsl format. The hierarchy snapshot (.hbs) is loaded"
+			" instead of the clustering to re-output its clusters with the -c{r,a,l} options\n"
 			"\n"
 			"Rev: " << libBuild().rev() << "." << clientBuild().rev() <<
 			" (" << to_string(libBuild().clustering) << ")\n";
@@ -1326,6 +1829,11 @@ void Client::info(const char filename[]) const
 
 void Client::execute()
 {
+	// The hierarchy snapshot is loaded and re-outputted without the clustering
+	if(hasExtension(m_inpopts.filename, FileExts::HBS)) {
+		reoutput();
+		return;
+	}
 	// Try to identify input format by the extension
 	if(m_inpopts.format == FileFormat::UNKNOWN)
 		m_inpopts.format = inpFileFmt(m_inpopts.filename.c_str());
@@ -1349,10 +1857,62 @@ void Client::execute()
 	}
 }
 
+void Client::reoutput()
+{
+	if(m_evals)
+		throw invalid_argument("reoutput(), the evaluation is not applicable to the hierarchy snapshot\n");
+	const HbsParser  snap(m_inpopts.filename);
+	if(m_opts.timing)
+		m_opts.timing->loadnet = m_opts.timing->update();
+
+	for(const auto& outopt: m_opts.outputs) {
+		std::deque<CompressedFile>  cfiles;  // Output files, compressed on the fly if required
+		FileWrappers  fouts;  // Non-owning views of the cfiles for the parser
+		//! Create the output file
+		auto create = [&cfiles, &fouts](const string& fname) {
+			cfiles.emplace_back(fname, outpCodec(fname));
+			fouts.emplace_back(static_cast<FILE*>(cfiles.back().file()), false);
+		};
+		if(toClsOutFmt(outopt.clsfmt & ClsOutFmt::MASK_OUTSTRUCT) == ClsOutFmt::PERLEVEL) {
+			const auto  fnames = levelFileNames(outopt.clsfile, snap.header().levsnum);
+			for(const auto& fname: fnames)
+				create(fname);
+		} else create(outopt.clsfile);
+		snap.output(fouts, outopt.clsfmt, outopt.fltMembers);
+		fouts.clear();
+		for(auto& cf: cfiles)
+			cf.close();
+	}
+
+	if(m_opts.timing) {
+		auto& t = *m_opts.timing;
+		t.outpfile = t.update();
+		puts("-reoutput(), timings:");
+		Timing::print(t.loadnet, "-  hierarchy snapshot loading: ");
+		Timing::print(t.outpfile, "-  results serialization: ");
+	}
+}
+
+//! \brief Apply the input options that are not considered by the parser constructor
+//!
+//! \tparam ParserT  - input network parser
+//!
+//! \param parser ParserT&  - the parser to be configured
+//! \param inpopts const InpOptions&  - input network options
+//! \return void
+template<typename ParserT>
+static void applyInpOptions(ParserT&, const InpOptions&)  {}
+
+static void applyInpOptions(NslParser& parser, const InpOptions& inpopts)
+{
+	parser.mirrored(inpopts.mirrored);
+}
+
 template<typename ParserT>
 void Client::execute()
 {
 	ParserT  parser(m_inpopts);
+	applyInpOptions(parser, m_inpopts);
 
 	// Note: nodes are reduced on clustering if required, not on the graph construction
 	if(parser.weighted())
@@ -1371,6 +1931,12 @@ void Client::execute()
 			Timing::print(t.cluster, "-  clustering: ");
 		if(t.evaluate)
 			Timing::print(t.evaluate, "-  evaluation: ");
+		if(t.evalcdn)
+			Timing::print(t.evalcdn, "-    conductance: ");
+		if(t.evalmod)
+			Timing::print(t.evalmod, "-    modularity: ");
+		if(t.evalgamma)
+			Timing::print(t.evalgamma, "-    static gamma: ");
 		if(t.outpfile)
 			Timing::print(t.outpfile, "-  results serialization: ");
 		if(t.outpterm)
@@ -1394,56 +1960,381 @@ void Client::process(Graph<WEIGHTED>& graph)
 	, toYesNo(directed), toYesNo(graph.reduced()), toYesNo(m_inpopts.shuffle));
 #endif // TRACE
 
-	if(m_evals) {
-		using LinksT = typename Graph<WEIGHTED>::LinksT;
-		Clusters<LinksT>  cls;  // Loaded clusters
-		// Load evaluating clusters
-		const auto& outopt = m_opts.outputs.front();
-		AccWeight  weight = loadClusters<CnlParser>(cls, graph
-			, outopt.clsfile, m_opts.clustering.validation);
-		// Measure the [ground-truth] clusters loading time
-		if(m_opts.timing)
-			m_opts.timing->loadcls = m_opts.timing->update();
+	if(m_evals)
+		evaluate(graph);
+	else processNodes(*graph.release(), !directed, m_opts, m_showver);
+	// ATTENTION: graph should NOT be finalized here to be able to get a node by id
+}
 
-		if(directed)
-			intrinsicMeasures<true>(m_evals, cls, weight, m_opts.clustering.gamma);
-		else intrinsicMeasures<false>(m_evals, cls, weight, m_opts.clustering.gamma);
-		// Measure the evaluation time
+template <bool WEIGHTED>
+void Client::evaluate(Graph<WEIGHTED>& graph)
+{
+	vector<Evaluation>  evals(m_opts.outputs.size());
+	for(size_t i = 0; i < evals.size(); ++i)
+		evals[i].clsfile = m_opts.outputs[i].clsfile;
+	const unsigned  jobs = evals.size() >= 2 ? std::min<size_t>(m_evaljobs, evals.size()) : 1;
+	// Load and index the ground-truth once for all evaluating clusterings
+	unique_ptr<AccuracyEvaluator<Id>>  acceval;
+	if(!m_gtfile.empty()) {
+		Timing  tgt;
+		NamedFileWrapper  fgt(m_gtfile.c_str(), "rb");
+		if(!fgt)
+			throw std::ios_base::failure(string("ERROR evaluate(), the ground-truth file can't be opened: ")
+				.append(m_gtfile) += '\n');
+		// Note: the workers are shared between the concurrent jobs
+		acceval.reset(new AccuracyEvaluator<Id>(loadMembership<Id>(fgt, 0, 0, false)
+			, std::max<unsigned>(workersNum(size_t(-1)) / jobs, 1)));
 		if(m_opts.timing)
-			m_opts.timing->evaluate = m_opts.timing->update();
-
-#if VALIDATE >= 2
-		// Note: it's fine that for arbitrary cluster modularity can be negative, but it is always >= -1
-#if TRACE >= 1
-		// ATTENTION: reasonable precision is at most precision of the underlying items
-		using  WeightT = typename LinksT::value_type::Weight;
-		if(less<WeightT>(m_evals.mod))
-			fprintf(ftrace, "WARNING process(), modularity is negative: %G\n", m_evals.mod);
+			m_opts.timing->loadcls += tgt.update();
+	}
+	if(evals.size() == 1)
+		evaluate(evals.front(), graph, acceval.get());  // Note: the evaluation errors are propagated
+	else {
+#if TRACE >= 2
+		printf("-evaluate(), evaluating %lu clusterings by %u jobs\n", evals.size(), jobs);
 #endif // TRACE
-		assert(!less<WeightT>(m_evals.mod, -0.5) && !less<LinkWeight>(1, m_evals.mod)
-			&& string("process(), modularity E [-0.5, 1]: mod = ").append(to_string(m_evals.mod)).c_str());
-#endif // VALIDATE
-		//fputs("-", stdout);
+		std::atomic<size_t>  ieval(0);  // Index of the next clustering to be evaluated
+		// Each job evaluates the clusterings one by one, so at most jobs clusterings are in flight
+		// Note: loadClusters() resets the graph, so each clustering is evaluated on its own
+		// in-memory replica of the graph, the original graph is only read
+		parallelRanges(jobs, [&](size_t, size_t, unsigned) {
+			for(size_t i = ieval++; i < evals.size(); i = ieval++)
+				try {
+					auto  replica = graph.replica();
+					evaluate(evals[i], replica, acceval.get());
+				} catch(std::exception& err) {
+					evals[i].error = err.what();
+				}
+		}, jobs);
+	}
+
+	// Output the evaluations
+	const bool  named = evals.size() >= 2;  // Whether to show the evaluated file names
+	for(const auto& ev: evals) {
+		if(!ev.error.empty()) {
+			fprintf(ftrace, "-ERROR evaluate(), %s: %s", ev.clsfile.c_str(), ev.error.c_str());
+			continue;
+		}
+		const auto&  ins = ev.measures;
+		if(named)
+			printf("%s: ", ev.clsfile.c_str());
 		bool initialized = false;
+		// Note: measures.flags might include the measures required for the modularity curve
 		if(m_evals.flags & IntrinsicsFlags::CONDUCTANCE) {
-			printf("Conductance f: %G", m_evals.cdn);
+			printf("Conductance f: %G", ins.cdn);
 			initialized = true;
 		}
 		if(m_evals.flags & IntrinsicsFlags::MODULARITY) {
 			if(initialized)
 				fputs(", ", stdout);
-			printf("Q: %G on gamma=%G", m_evals.mod, m_opts.clustering.gamma);
+			printf("Q: %G on gamma=%G", ins.mod, m_opts.clustering.gamma);
 			initialized = true;
 		}
 		if(m_evals.flags & IntrinsicsFlags::GAMMA) {
 			if(initialized)
 				fputs(", ", stdout);
 			printf("Q*: %G on the expected static (Newman's) gamma=%G"
-				, m_evals.sgmod, m_evals.gamma);  // Expected static Newman's gamma
+				, ins.sgmod, ins.gamma);  // Expected static Newman's gamma
 		}
-		printf(", clusters: %lu\n", cls.size());
-	} else processNodes(*graph.release(), !directed, m_opts, m_showver);
-	// ATTENTION: graph should NOT be finalized here to be able to get a node by id
+		printf(", clusters: %lu\n", ev.clusters);
+		if(!m_gammas.empty()) {
+			fputs("Q(gamma):", stdout);
+			for(auto gamma: m_gammas)
+				printf(" %G:%G", gamma, ev.modularity(gamma));
+			printf("; argmax gamma=%G\n", argmaxGamma(ev));
+		}
+		if(acceval) {
+			const auto&  acc = ev.accuracy;
+			fputs("Accuracy:", stdout);
+			if(acc.flags & ACC_F1)
+				printf(" F1: %G (ground-truth: %G, clusters: %G)", acc.f1, acc.f1gt, acc.f1cl);
+			if(acc.flags & ACC_ONMI)
+				printf(" ONMI: %G", acc.onmi);
+			if(acc.flags & ACC_OMEGA)
+				printf(" Omega: %G", acc.omega);
+			fputc('\n', stdout);
+		}
+	}
+	if(!m_evaltab.empty())
+		outputEvaluations(evals);
+
+	// Accumulate the timings of all evaluations
+	if(m_opts.timing) {
+		auto&  t = *m_opts.timing;
+		for(const auto& ev: evals) {
+			t.loadcls += ev.timing.loadcls;
+			t.evaluate += ev.timing.evaluate;
+			t.evalcdn += ev.timing.evalcdn;
+			t.evalmod += ev.timing.evalmod;
+			t.evalgamma += ev.timing.evalgamma;
+		}
+		t.update();  // Note: the durations are accumulated above
+	}
+}
+
+//! Accumulated modularity terms of the clusters
+struct ModTerms {
+	AccWeight  intra;  //!< Sum of the internal weights of the clusters
+	AccWeight  expect;  //!< Sum of the squared full weights of the clusters
+
+	ModTerms() noexcept: intra(0), expect(0)  {}
+
+	ModTerms& operator +=(const ModTerms& mt) noexcept
+	{
+		intra += mt.intra;
+		expect += mt.expect;
+		return *this;
+	}
+};
+
+template <bool WEIGHTED>
+void Client::evaluate(Evaluation& eval, Graph<WEIGHTED>& graph
+	, const AccuracyEvaluator<Id>* acceval) const
+{
+	using LinksT = typename Graph<WEIGHTED>::LinksT;
+	const bool  directed = graph.directed();
+	auto&  t = eval.timing;
+	t.update();  // Reset the timestamp
+	Clusters<LinksT>  cls;  // Loaded clusters
+	// Load evaluating clusters
+	// Note: the binary membership is loaded without the parsing
+	AccWeight  weight = hasExtension(eval.clsfile, FileExts::CNB)
+		? loadClusters<CnbParser>(cls, graph, eval.clsfile, m_opts.clustering.validation)
+		: loadClusters<CnlParser>(cls, graph, eval.clsfile, m_opts.clustering.validation);
+	eval.clusters = cls.size();
+	// Measure the [ground-truth] clusters loading time
+	t.loadcls = t.update();
+
+	auto&  evals = eval.measures;
+	evals.flags = m_evals.flags;
+	// Index the clusters to evaluate them in parallel
+	vector<const Cluster<LinksT>*>  icls;
+	icls.reserve(cls.size());
+	for(const auto& cl: cls)
+		icls.push_back(&cl);
+	// Note: the workers are shared between the concurrent evaluations
+	const unsigned  workers = workersNum(icls.size(), 1 << 12
+		, std::max<unsigned>(workersNum(size_t(-1)) / m_evaljobs, 1));
+	t.loadcls += t.update();
+
+	// Evaluate the conductance: mean of cut / full weight of the clusters
+	if(evals.flags & IntrinsicsFlags::CONDUCTANCE) {
+		const AccWeight  cdnsum = parallelReduce<AccWeight>(icls.size(), [&icls](size_t ib, size_t ie) {
+			AccWeight  cdn = 0;
+			for(; ib < ie; ++ib) {
+				const auto&  cl = *icls[ib];
+				const AccWeight  ctxweight = cl.ctxWeight();  // Full weight of the cluster
+				if(ctxweight)
+					cdn += (ctxweight - cl.weight()) / ctxweight;
+			}
+			return cdn;
+		}, workers);
+		evals.cdn = icls.empty() ? 0 : cdnsum / icls.size();
+		t.evalcdn = t.update();
+	}
+	// Evaluate the modularity terms in a single pass: Q(gamma) = qintra - gamma * qexpect,
+	// qintra = sum(w_c) / w, qexpect = sum(w_ctx^2) / w^2
+	if(evals.flags & IntrinsicsFlags::MODULARITY || !m_gammas.empty()) {
+		const ModTerms  terms = parallelReduce<ModTerms>(icls.size(), [&icls](size_t ib, size_t ie) {
+			ModTerms  mt;
+			for(; ib < ie; ++ib) {
+				const auto&  cl = *icls[ib];
+				const AccWeight  ctxweight = cl.ctxWeight();  // Full weight of the cluster
+				mt.intra += cl.weight();  // Internal (self-weight) of the cluster
+				mt.expect += ctxweight * ctxweight;
+			}
+			return mt;
+		}, workers);
+		eval.qintra = weight ? terms.intra / weight : 0;
+		eval.qexpect = weight ? terms.expect / (weight * weight) : 0;
+		if(evals.flags & IntrinsicsFlags::MODULARITY)
+			evals.mod = eval.modularity(m_opts.clustering.gamma);
+		t.evalmod = t.update();
+	}
+	// Evaluate the expected static (Newman's) gamma and the modularity on it
+	if(evals.flags & IntrinsicsFlags::GAMMA) {
+		Intrinsics  ins;
+		ins.flags = IntrinsicsFlags::GAMMA;
+		if(directed)
+			intrinsicMeasures<true>(ins, cls, weight, m_opts.clustering.gamma);
+		else intrinsicMeasures<false>(ins, cls, weight, m_opts.clustering.gamma);
+		evals.sgmod = ins.sgmod;
+		evals.gamma = ins.gamma;
+		t.evalgamma = t.update();
+	}
+	t.evaluate = t.evalcdn + t.evalmod + t.evalgamma;
+
+	// Evaluate the extrinsic accuracy against the ground-truth
+	if(acceval) {
+		// Form the membership from the already loaded clusters
+		Membership<Id>  mbs;
+		mbs.offsets.reserve(cls.size() + 1);
+		vector<Id>  cnds;  // Cluster nodes
+		for(const auto& cl: cls) {
+			cnds.clear();
+			cnds.reserve(cl.des.size());
+			for(const auto& nd: cl.des)
+				cnds.push_back(nd->id);
+			mbs.add(cnds);
+		}
+		t.loadcls += t.update();
+		eval.accuracy = acceval->evaluate(mbs, m_accflags);
+		t.evaluate += t.update();
+	}
+
+#if VALIDATE >= 2
+	// Note: it's fine that for arbitrary cluster modularity can be negative, but it is always >= -1
+#if TRACE >= 1
+	// ATTENTION: reasonable precision is at most precision of the underlying items
+	using  WeightT = typename LinksT::value_type::Weight;
+	if(less<WeightT>(evals.mod))
+		fprintf(ftrace, "WARNING evaluate(), modularity is negative: %G\n", evals.mod);
+#endif // TRACE
+	assert(!less<WeightT>(evals.mod, -0.5) && !less<LinkWeight>(1, evals.mod)
+		&& string("evaluate(), modularity E [-0.5, 1]: mod = ").append(to_string(evals.mod)).c_str());
+#endif // VALIDATE
+}
+
+AccWeight Client::argmaxGamma(const Evaluation& eval) const
+{
+	assert(!m_gammas.empty() && "argmaxGamma(), the resolution grid is expected");
+	AccWeight  gamma = m_gammas.front();
+	AccWeight  qmax = eval.modularity(gamma);
+	for(auto g: m_gammas) {
+		const AccWeight  q = eval.modularity(g);
+		if(q > qmax) {
+			qmax = q;
+			gamma = g;
+		}
+	}
+	return gamma;
+}
+
+void Client::outputEvaluations(const vector<Evaluation>& evals) const
+{
+	FileWrapper  fout(fopen(m_evaltab.c_str(), "w"));
+	if(!fout)
+		throw std::ios_base::failure(string("ERROR outputEvaluations(), the output file can't be created: ")
+			.append(m_evaltab) += '\n');
+	const bool  json = hasExtension(m_evaltab, "json");
+	//! Output the quoted and escaped string
+	auto putStr = [&fout, json](const string& str) {
+		fputc('"', fout);
+		for(char c: str) {
+			if(c == '\n')
+				continue;
+			if(c == '"')
+				fputc(json ? '\\' : '"', fout);  // CSV doubles the quote
+			else if(c == '\\' && json)
+				fputc('\\', fout);
+			fputc(c, fout);
+		}
+		fputc('"', fout);
+	};
+	const auto  flags = m_evals.flags;
+	const AccWeight  gamma = m_opts.clustering.gamma;
+	if(json) {
+		fputs("[", fout);
+		bool  first = true;
+		for(const auto& ev: evals) {
+			fputs(first ? "\n\t{\"file\": " : ",\n\t{\"file\": ", fout);
+			first = false;
+			putStr(ev.clsfile);
+			if(!ev.error.empty()) {
+				fputs(", \"error\": ", fout);
+				putStr(ev.error);
+				fputs("}", fout);
+				continue;
+			}
+			fprintf(fout, ", \"clusters\": %lu", ev.clusters);
+			if(flags & IntrinsicsFlags::CONDUCTANCE)
+				fprintf(fout, ", \"conductance\": %.12G", ev.measures.cdn);
+			if(flags & IntrinsicsFlags::MODULARITY)
+				fprintf(fout, ", \"modularity\": %.12G, \"gamma\": %.12G", ev.measures.mod, gamma);
+			if(flags & IntrinsicsFlags::GAMMA)
+				fprintf(fout, ", \"static_modularity\": %.12G, \"static_gamma\": %.12G"
+					, ev.measures.sgmod, ev.measures.gamma);
+			if(!m_gammas.empty()) {
+				fputs(", \"modularity_curve\": [", fout);
+				for(size_t i = 0; i < m_gammas.size(); ++i)
+					fprintf(fout, i ? ", [%.12G, %.12G]" : "[%.12G, %.12G]"
+						, m_gammas[i], ev.modularity(m_gammas[i]));
+				fprintf(fout, "], \"argmax_gamma\": %.12G", argmaxGamma(ev));
+			}
+			if(m_accflags & ACC_F1)
+				fprintf(fout, ", \"f1\": %.12G, \"f1_groundtruth\": %.12G, \"f1_clusters\": %.12G"
+					, ev.accuracy.f1, ev.accuracy.f1gt, ev.accuracy.f1cl);
+			if(m_accflags & ACC_ONMI)
+				fprintf(fout, ", \"onmi\": %.12G", ev.accuracy.onmi);
+			if(m_accflags & ACC_OMEGA)
+				fprintf(fout, ", \"omega\": %.12G", ev.accuracy.omega);
+			fputs("}", fout);
+		}
+		fputs("\n]\n", fout);
+	} else {
+		fputs("File,Clusters", fout);
+		if(flags & IntrinsicsFlags::CONDUCTANCE)
+			fputs(",Conductance", fout);
+		if(flags & IntrinsicsFlags::MODULARITY)
+			fputs(",Modularity,Gamma", fout);
+		if(flags & IntrinsicsFlags::GAMMA)
+			fputs(",StaticModularity,StaticGamma", fout);
+		for(auto gamma: m_gammas)
+			fprintf(fout, ",Q@%G", gamma);
+		if(!m_gammas.empty())
+			fputs(",ArgmaxGamma", fout);
+		if(m_accflags & ACC_F1)
+			fputs(",F1,F1GroundTruth,F1Clusters", fout);
+		if(m_accflags & ACC_ONMI)
+			fputs(",ONMI", fout);
+		if(m_accflags & ACC_OMEGA)
+			fputs(",Omega", fout);
+		fputs(",Error\n", fout);
+		for(const auto& ev: evals) {
+			putStr(ev.clsfile);
+			if(ev.error.empty()) {
+				fprintf(fout, ",%lu", ev.clusters);
+				if(flags & IntrinsicsFlags::CONDUCTANCE)
+					fprintf(fout, ",%.12G", ev.measures.cdn);
+				if(flags & IntrinsicsFlags::MODULARITY)
+					fprintf(fout, ",%.12G,%.12G", ev.measures.mod, gamma);
+				if(flags & IntrinsicsFlags::GAMMA)
+					fprintf(fout, ",%.12G,%.12G", ev.measures.sgmod, ev.measures.gamma);
+				for(auto gamma: m_gammas)
+					fprintf(fout, ",%.12G", ev.modularity(gamma));
+				if(!m_gammas.empty())
+					fprintf(fout, ",%.12G", argmaxGamma(ev));
+				if(m_accflags & ACC_F1)
+					fprintf(fout, ",%.12G,%.12G,%.12G", ev.accuracy.f1, ev.accuracy.f1gt, ev.accuracy.f1cl);
+				if(m_accflags & ACC_ONMI)
+					fprintf(fout, ",%.12G", ev.accuracy.onmi);
+				if(m_accflags & ACC_OMEGA)
+					fprintf(fout, ",%.12G", ev.accuracy.omega);
+				fputs(",\n", fout);
+			} else {
+				fputc(',', fout);
+				if(flags & IntrinsicsFlags::CONDUCTANCE)
+					fputc(',', fout);
+				if(flags & IntrinsicsFlags::MODULARITY)
+					fputs(",,", fout);
+				if(flags & IntrinsicsFlags::GAMMA)
+					fputs(",,", fout);
+				for(size_t i = 0; i < m_gammas.size(); ++i)
+					fputc(',', fout);
+				if(!m_gammas.empty())
+					fputc(',', fout);
+				if(m_accflags & ACC_F1)
+					fputs(",,,", fout);
+				if(m_accflags & ACC_ONMI)
+					fputc(',', fout);
+				if(m_accflags & ACC_OMEGA)
+					fputc(',', fout);
+				fputc(',', fout);
+				putStr(ev.error);
+				fputc('\n', fout);
+			}
+		}
+	}
 }
 
 // Build Information Definition -----------------------------------------------
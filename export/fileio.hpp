@@ -16,7 +16,13 @@
 #include "fileio/parser_rcg.hpp"
 #include "fileio/parser_nsl.hpp"
 #include "fileio/parser_cnl.hpp"
+#include "fileio/parser_hbs.hpp"
+#include "fileio/parser_cnb.hpp"
+#include "fileio/compressed.hpp"
+#include "fileio/printer_npy.hpp"
 #include "fileio/printer_cnl.hpp"
 #include "fileio/printer_rhb.hpp"
+#include "fileio/printer_hbs.hpp"
+#include "fileio/flathier.hpp"
 
 #endif // FILEIO_HPP
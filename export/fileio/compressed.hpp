@@ -0,0 +1,349 @@
+//! \brief Streaming compressed output files.
+//! The Dao (Deterministic Agglomerative Overlapping) of Clustering library:
+//! Robust & Fine-grained Deterministic Clustering for Large Networks.
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#ifndef COMPRESSED_HPP
+#define COMPRESSED_HPP
+
+#include <cstdio>
+#include <cstring>  // strlen, strerror
+#include <cerrno>  // errno
+#include <stdexcept>  // invalid_argument
+#include <ios>  // ios_base::failure
+#include <thread>
+#include <vector>
+
+#ifdef __unix__
+#include <unistd.h>  // pipe, read, close
+#endif // __unix__
+
+#ifdef DAOC_ZLIB
+#include <zlib.h>
+#endif // DAOC_ZLIB
+#ifdef DAOC_ZSTD
+#include <zstd.h>
+#endif // DAOC_ZSTD
+
+#include "fileio/iotypes.h"
+
+
+namespace daoc {
+
+using std::thread;
+using std::invalid_argument;
+
+// Compression related definitions ---------------------------------------------
+//! Compression codec of the output file
+enum class Codec: uint8_t {
+	NONE = 0,  //!< Uncompressed output
+	GZIP,  //!< Gzip (zlib deflate with the gzip wrapper), requires DAOC_ZLIB
+	ZSTD  //!< Zstandard, requires DAOC_ZSTD
+};
+
+//! \brief Convert Codec to string
+//! \relates Codec
+//!
+//! \param codec Codec  - the codec to be converted
+//! \return string  - resulting codec as a string
+inline string to_string(Codec codec)
+{
+	switch(codec) {
+	case Codec::GZIP:
+		return "GZIP";
+	case Codec::ZSTD:
+		return "ZSTD";
+	default:
+		return "NONE";
+	}
+}
+
+//! Extensions of the compressed files, which follow the original extension: .cnl.zst
+namespace CodecExts {
+	constexpr char GZIP[] = "gz";
+	constexpr char ZSTD[] = "zst";
+};
+
+//! \brief Infer the compression codec by the file extension
+//!
+//! \param filename const string&  - file name
+//! \return Codec  - compression codec, NONE for the unknown extensions
+inline Codec outpCodec(const string& filename) noexcept
+{
+	if(hasExtension(filename, CodecExts::GZIP))
+		return Codec::GZIP;
+	if(hasExtension(filename, CodecExts::ZSTD))
+		return Codec::ZSTD;
+	return Codec::NONE;
+}
+
+//! \brief File name without the compression extension
+//!
+//! \param filename const string&  - file name
+//! \return string  - file name without the compression extension if any
+inline string uncompressedName(const string& filename)
+{
+	switch(outpCodec(filename)) {
+	case Codec::GZIP:
+		return filename.substr(0, filename.size() - strlen(CodecExts::GZIP) - 1);
+	case Codec::ZSTD:
+		return filename.substr(0, filename.size() - strlen(CodecExts::ZSTD) - 1);
+	default:
+		return filename;
+	}
+}
+
+// Compressed output file ------------------------------------------------------
+//! \brief Output file compressed on the fly in the background thread
+//! \note The written data is passed through the pipe to the worker thread,
+//! 	which compresses it to the target file. So the printers (CnlPrinter,
+//! 	RhbPrinter) are used as is, but the file() is not seekable for the
+//! 	compressed output. The uncompressed output is written directly.
+class CompressedFile {
+	FileWrapper  m_file;  //!< Write end of the pipe, or the target file for Codec::NONE
+	FileWrapper  m_target;  //!< Compressed target file
+	thread  m_worker;  //!< Compressing worker
+	string  m_error;  //!< Error of the worker, empty on success
+public:
+	//! Size of the chunks processed by the worker
+	static constexpr size_t  CHUNK = 1 << 18;
+
+	//! \brief Default constructor
+	CompressedFile() noexcept: m_file(), m_target(), m_worker(), m_error()  {}
+
+	//! \brief Open the output file
+	//! \note Throws ios_base::failure on the file creation failure and
+	//! 	invalid_argument if the codec is not supported by the build
+	//!
+	//! \param filename const string&  - output file name
+	//! \param codec Codec  - compression codec
+	CompressedFile(const string& filename, Codec codec): CompressedFile()
+	{ open(filename, codec); }
+
+	CompressedFile(const CompressedFile&)=delete;
+	CompressedFile& operator= (const CompressedFile&)=delete;
+
+	//! \brief Destructor, finalizes the output if it has not been closed
+	~CompressedFile();
+
+	//! \brief Open the output file closing the previous one
+	//! \note Throws ios_base::failure on the file creation failure and
+	//! 	invalid_argument if the codec is not supported by the build
+	//!
+	//! \param filename const string&  - output file name
+	//! \param codec Codec  - compression codec
+	//! \return void
+	void open(const string& filename, Codec codec);
+
+	//! \brief The file to be written
+	FileWrapper& file() noexcept  { return m_file; }
+
+	//! \brief Whether the file is opened
+	explicit operator bool() const noexcept  { return m_file; }
+
+	//! \brief Flush and finalize the output waiting for the worker completion
+	//! \note Throws ios_base::failure on the compression failure
+	//!
+	//! \return void
+	void close();
+protected:
+	//! \brief Compress the input stream to the output file
+	//!
+	//! \param fdin int  - input file descriptor (read end of the pipe)
+	//! \param fout FILE*  - output file
+	//! \param codec Codec  - compression codec
+	//! \param err string&  - resulting error, empty on success
+	//! \return void
+	static void compress(int fdin, FILE* fout, Codec codec, string& err) noexcept;
+};
+
+// CompressedFile definition ---------------------------------------------------
+inline CompressedFile::~CompressedFile()
+{
+	if(m_file) {
+		try {
+			close();
+		} catch(std::exception& err) {
+			fprintf(stderr, "WARNING ~CompressedFile(), the output finalization failed: %s\n", err.what());
+		}
+	}
+}
+
+inline void CompressedFile::open(const string& filename, Codec codec)
+{
+	close();
+	switch(codec) {
+	case Codec::NONE:
+		break;
+#ifdef DAOC_ZLIB
+	case Codec::GZIP:
+		break;
+#endif // DAOC_ZLIB
+#ifdef DAOC_ZSTD
+	case Codec::ZSTD:
+		break;
+#endif // DAOC_ZSTD
+	default:
+		throw invalid_argument(string("open(), the compression codec is not supported by the build: ")
+			.append(to_string(codec)) += '\n');
+	}
+	const bool  compr = codec != Codec::NONE;
+	(compr ? m_target : m_file).reset(fopen(filename.c_str(), "wb"));
+	if(!(compr ? m_target : m_file))
+		throw std::ios_base::failure(string("ERROR open(), the output file can't be created: ")
+			.append(filename) += '\n');
+	if(!compr)
+		return;
+#ifdef __unix__
+	int  fds[2];  // Read and write ends of the pipe
+	if(pipe(fds)) {
+		m_target.reset();
+		throw std::ios_base::failure(string("ERROR open(), the pipe can't be created: ")
+			.append(strerror(errno)) += '\n');
+	}
+	m_file.reset(fdopen(fds[1], "w"));
+	if(!m_file) {
+		::close(fds[0]);
+		::close(fds[1]);
+		m_target.reset();
+		throw std::ios_base::failure("ERROR open(), the pipe can't be opened\n");
+	}
+	m_error.clear();
+	m_worker = thread(compress, fds[0], static_cast<FILE*>(m_target), codec, std::ref(m_error));
+#else
+	m_target.reset();
+	throw invalid_argument("open(), the compressed output requires POSIX pipes\n");
+#endif // __unix__
+}
+
+inline void CompressedFile::close()
+{
+	// Note: closing the write end of the pipe completes the worker
+	m_file.reset();
+	if(m_worker.joinable())
+		m_worker.join();
+	if(m_target && fclose(m_target.release()) && m_error.empty())
+		m_error = "the compressed file closing failed";
+	if(!m_error.empty()) {
+		const string  err = std::move(m_error);
+		m_error.clear();
+		throw std::ios_base::failure(string("ERROR close(), ").append(err) += '\n');
+	}
+}
+
+inline void CompressedFile::compress(int fdin, FILE* fout, Codec codec, string& err) noexcept
+{
+#ifdef __unix__
+	vector<char>  inbuf(CHUNK);
+	vector<char>  outbuf(CHUNK);
+	//! Read the next chunk from the pipe, -1 on failure
+	auto readChunk = [fdin, &inbuf]() noexcept -> ssize_t {
+		ssize_t  num;
+		do num = read(fdin, inbuf.data(), inbuf.size());
+		while(num < 0 && errno == EINTR);
+		return num;
+	};
+#if defined(DAOC_ZLIB) || defined(DAOC_ZSTD)
+	//! Write the compressed data
+	auto put = [fout](const char* data, size_t size) noexcept -> bool {
+		return fwrite(data, 1, size, fout) == size;
+	};
+	ssize_t  num = 0;  // The number of read bytes
+#else
+	(void)fout;  // Note: no codecs are supported by the build
+#endif // DAOC_ZLIB || DAOC_ZSTD
+
+	switch(codec) {
+#ifdef DAOC_ZLIB
+	case Codec::GZIP: {
+		z_stream  zs = {};
+		// 15 + 16: max window size with the gzip wrapper
+		if(deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+			err = "gzip initialization failed";
+			break;
+		}
+		int  flush;
+		int  zres = Z_OK;  // Deflate result
+		do {
+			num = readChunk();
+			if(num < 0) {
+				err = "the pipe reading failed";
+				break;
+			}
+			flush = num ? Z_NO_FLUSH : Z_FINISH;
+			zs.next_in = reinterpret_cast<Bytef*>(inbuf.data());
+			zs.avail_in = num;
+			do {
+				zs.next_out = reinterpret_cast<Bytef*>(outbuf.data());
+				zs.avail_out = outbuf.size();
+				// Note: Z_BUF_ERROR is not fatal (no progress is possible in this call),
+				// the stream completion is validated by Z_STREAM_END after Z_FINISH
+				zres = deflate(&zs, flush);
+				if(zres == Z_STREAM_ERROR) {
+					err = string("gzip compression failed: ") += zs.msg ? zs.msg : "inconsistent stream state";
+					break;
+				}
+				if(!put(outbuf.data(), outbuf.size() - zs.avail_out)) {
+					err = "the compressed data writing failed";
+					break;
+				}
+			} while(!zs.avail_out);
+		} while(flush != Z_FINISH && err.empty());
+		if(err.empty() && zres != Z_STREAM_END)
+			err = "gzip compression is not finalized";
+		deflateEnd(&zs);
+	} break;
+#endif // DAOC_ZLIB
+#ifdef DAOC_ZSTD
+	case Codec::ZSTD: {
+		ZSTD_CCtx*  cctx = ZSTD_createCCtx();
+		if(!cctx) {
+			err = "zstd initialization failed";
+			break;
+		}
+		bool  done = false;
+		do {
+			num = readChunk();
+			if(num < 0) {
+				err = "the pipe reading failed";
+				break;
+			}
+			const ZSTD_EndDirective  mode = num ? ZSTD_e_continue : ZSTD_e_end;
+			ZSTD_inBuffer  input = {inbuf.data(), static_cast<size_t>(num), 0};
+			do {
+				ZSTD_outBuffer  output = {outbuf.data(), outbuf.size(), 0};
+				const size_t  rem = ZSTD_compressStream2(cctx, &output, &input, mode);
+				if(ZSTD_isError(rem)) {
+					err = string("zstd compression failed: ") += ZSTD_getErrorName(rem);
+					break;
+				}
+				if(!put(outbuf.data(), output.pos)) {
+					err = "the compressed data writing failed";
+					break;
+				}
+				done = mode == ZSTD_e_end ? !rem : input.pos == input.size;
+			} while(!done);
+		} while(num && err.empty());
+		ZSTD_freeCCtx(cctx);
+	} break;
+#endif // DAOC_ZSTD
+	default:
+		err = string("unsupported compression codec: ") += to_string(codec);
+	}
+	// Drain the pipe on failure to not block the writer
+	if(!err.empty())
+		while(readChunk() > 0);
+	::close(fdin);
+#endif // __unix__
+}
+
+}  // daoc
+
+#endif // COMPRESSED_HPP
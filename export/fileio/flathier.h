@@ -0,0 +1,84 @@
+//! \brief Flat (array-based) representation of the hierarchy of clusters.
+//! The Dao (Deterministic Agglomerative Overlapping) of Clustering library:
+//! Robust & Fine-grained Deterministic Clustering for Large Networks.
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#ifndef FLATHIER_H
+#define FLATHIER_H
+
+#include <memory>  // shared_ptr, enable_shared_from_this
+
+#include "fileio/iotypes.h"
+
+namespace daoc {
+
+using std::shared_ptr;
+
+//! \brief Flat level of the hierarchy: membership of the nodes in the clusters
+//! 	as contiguous arrays in the CSR-like layout
+//! \note The level consists of the clusters of the level and the clusters
+//! 	propagated from the lower levels (having owners on the upper levels
+//! 	only or being root), the same as the per-level CNL output
+struct FlatLevel {
+	Items<Id>  ids;  //!< Cluster ids
+	Items<Size>  offsets;  //!< Offsets of the cluster members, clusters + 1 items
+	Items<Id>  members;  //!< Member node ids, ordered by id within each cluster
+	Items<Share>  shares;  //!< Shares of the member nodes in the clusters
+	//! Index of the (first) owner of each cluster on the next level, where the
+	//! propagated cluster is its own owner; ID_NONE on the top level
+	Items<Id>  parents;
+};
+
+//! \brief Flat hierarchy: per-level membership of the nodes in the clusters
+//! \note Built once, the arrays are immutable and shared by the consumers
+//! 	(for example NumPy arrays in the Python binding) without copying
+class FlatHierarchy
+#ifndef SWIG
+: public std::enable_shared_from_this<FlatHierarchy>
+#endif // SWIG
+{
+	Items<FlatLevel>  m_levels;  //!< Levels from the bottom
+public:
+    //! \brief Flat hierarchy constructor
+    //!
+    //! \param hier const Hierarchy<LinksT>&  - the hierarchy to be flattened
+    //! \param maxshare=false bool  - only the max share of the overlapping node
+    //! 	is retained, see Hierarchy::unwrap()
+	template <typename LinksT>
+	FlatHierarchy(const Hierarchy<LinksT>& hier, bool maxshare=false);
+
+    //! \brief The number of levels
+    //!
+    //! \return LevelNum  - the number of levels
+	LevelNum size() const noexcept  { return m_levels.size(); }
+
+    //! \brief Level of the hierarchy
+    //! \note Throws out_of_range for the invalid index
+    //!
+    //! \param ilev LevelNum  - index of the level from the bottom
+    //! \return const FlatLevel&  - the level
+	const FlatLevel& level(LevelNum ilev) const  { return m_levels.at(ilev); }
+
+	//! \copydoc m_levels
+	const Items<FlatLevel>& levels() const noexcept  { return m_levels; }
+};
+
+//! \brief Flatten the hierarchy
+//!
+//! \param hier const Hierarchy<LinksT>&  - the hierarchy to be flattened
+//! \param maxshare=false bool  - only the max share of the overlapping node
+//! 	is retained, see Hierarchy::unwrap()
+//! \return shared_ptr<FlatHierarchy>  - resulting flat hierarchy
+template <typename LinksT>
+shared_ptr<FlatHierarchy> flatten(const Hierarchy<LinksT>& hier, bool maxshare=false);
+
+}  // daoc
+
+#endif // FLATHIER_H
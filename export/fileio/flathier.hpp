@@ -0,0 +1,116 @@
+//! \brief Flat (array-based) representation of the hierarchy of clusters.
+//! The Dao (Deterministic Agglomerative Overlapping) of Clustering library:
+//! Robust & Fine-grained Deterministic Clustering for Large Networks.
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#ifndef FLATHIER_HPP
+#define FLATHIER_HPP
+
+#include <limits>  // numeric_limits
+#include <algorithm>  // sort
+#include <utility>  // pair
+
+#include "types.h"
+#include "flathash.hpp"  // FlatHashMap
+#include "fileio/flathier.h"
+
+namespace daoc {
+
+using std::make_shared;
+
+// FlatHierarchy ---------------------------------------------------------------
+template <typename LinksT>
+FlatHierarchy::FlatHierarchy(const Hierarchy<LinksT>& hier, bool maxshare)
+: m_levels()
+{
+	using ClusterT = Cluster<LinksT>;
+	//! Indexes of the clusters present on the level
+	using ClusterIndexes = FlatHashMap<const ClusterT*, Id>;
+	using NodeShare = std::pair<Id, Share>;
+
+	//! The lowest level where the cluster is not present (level of its owner)
+	auto elev = [](const ClusterT& cl) noexcept -> LevelNum {
+		return cl.owners.empty() ? std::numeric_limits<LevelNum>::max()
+			: cl.owners.front().dest->levnum;
+	};
+
+	// Note: the levels are not reallocated, so the previous level remains valid
+	m_levels.reserve(hier.levels().size());
+	Items<const ClusterT*>  pcls;  // Clusters present on the previous level
+	Items<const ClusterT*>  cls;  // Clusters present on the current level
+	ClusterIndexes  clinds;  // Indexes of the clusters present on the current level
+	Items<NodeShare>  cmembers;  // Members of the unwrapping cluster
+	LevelNum  levi = 0;
+	for(const auto& lev: hier.levels()) {
+		m_levels.emplace_back();
+		FlatLevel&  flev = m_levels.back();
+		cls.clear();
+		clinds.clear();
+		clinds.reserve(pcls.size() + lev.clusters.size());
+		flev.offsets.push_back(0);
+		// Clusters propagated from the previous level retain their members
+		if(levi) {
+			const FlatLevel&  plev = m_levels[levi - 1];
+			for(Id i = 0; i < pcls.size(); ++i) {
+				const ClusterT*  cl = pcls[i];
+				if(elev(*cl) <= levi)
+					continue;
+				const auto  ib = plev.offsets[i];
+				const auto  ie = plev.offsets[i + 1];
+				flev.members.insert(flev.members.end(), plev.members.begin() + ib
+					, plev.members.begin() + ie);
+				flev.shares.insert(flev.shares.end(), plev.shares.begin() + ib
+					, plev.shares.begin() + ie);
+				flev.ids.push_back(cl->id);
+				flev.offsets.push_back(flev.members.size());
+				clinds.emplace(cl, cls.size());
+				cls.push_back(cl);
+			}
+		}
+		// Clusters of the level
+		for(const auto& cl: lev.clusters) {
+			cmembers.clear();
+			for(const auto& cnd: hier.unwrap(cl, maxshare))  // first = node, second = share
+				cmembers.emplace_back(cnd.first->id, cnd.second);
+			std::sort(cmembers.begin(), cmembers.end()
+				, [](const NodeShare& a, const NodeShare& b) noexcept { return a.first < b.first; });
+			for(const auto& cnd: cmembers) {
+				flev.members.push_back(cnd.first);
+				flev.shares.push_back(cnd.second);
+			}
+			flev.ids.push_back(cl.id);
+			flev.offsets.push_back(flev.members.size());
+			clinds.emplace(&cl, cls.size());
+			cls.push_back(&cl);
+		}
+		// Parents of the previous level clusters
+		if(levi) {
+			auto&  parents = m_levels[levi - 1].parents;
+			parents.reserve(pcls.size());
+			for(auto pcl: pcls)
+				// Note: elev(*pcl) >= levi, since the cluster is present on the previous level
+				parents.push_back(clinds.at(elev(*pcl) == levi ? pcl->owners.front().dest : pcl));
+		}
+		pcls.swap(cls);
+		++levi;
+	}
+	if(!m_levels.empty())
+		m_levels.back().parents.assign(pcls.size(), ID_NONE);
+}
+
+template <typename LinksT>
+shared_ptr<FlatHierarchy> flatten(const Hierarchy<LinksT>& hier, bool maxshare)
+{
+	return make_shared<FlatHierarchy>(hier, maxshare);
+}
+
+}  // daoc
+
+#endif // FLATHIER_HPP
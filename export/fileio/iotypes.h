@@ -18,8 +18,10 @@
 #include <string>  // to_string
 #include <vector>
 #include <fstream>
+#include <cstring>  // strlen
 
 #include "macrodef.h"  // TRACE, VALIDATE, etc.
+#include "cnbformat.h"  // binAligned, CnbHeader
 
 
 namespace daoc {
@@ -51,6 +53,10 @@ enum class FileFormat: FileFormatBase {
 	// Output Formats
 	CNL,  //!< Cluster (community) Nodes List
 	RHB,  //!< Readable Hierarchy from Bottom format, .rcg-like
+	HBS,  //!< Hierarchy Binary Snapshot, mmap-able
+	CNLA,  //!< Indexed multi-level archive of the Cluster Nodes Lists
+	CNB,  //!< Cluster Nodes Binary membership, mmap-able
+	CMB,  //!< Cluster Metrics Binary, columnar
 
 	// Defaults
 	DEFAULT_INPUT = RCG
@@ -65,6 +71,10 @@ namespace FileExts {
 	// Output formats
 	constexpr char CNL[] = "cnl";
 	constexpr char RHB[] = "rhb";
+	constexpr char HBS[] = "hbs";
+	constexpr char CNLA[] = "cnla";
+	constexpr char CNB[] = "cnb";
+	constexpr char CMB[] = "cmb";
 };
 
 //! \brief Infer file format by the extension
@@ -91,13 +101,30 @@ struct InpOptions {
 	string  filename;  //! Evaluating input graph (network)
 	bool  sumdups;  //! Accumulate weights of the duplicated links or skip them (applicable only for the weighted graph)
 	bool  shuffle;  //! Shuffle (rand reorder) nodes and links
+	//! Each edge is listed in both directions (u v and v u), so the mirrored edges
+	//! (src id > dst id) are skipped in O(1) on loading (applicable only for NSE).
+	//! ATTENTION: an edge listed only as src id > dst id is lost in this mode.
+	bool  mirrored;
 
 	// Note: FileFormat::UNKNOWN is used initially to try fetch the format from the file extension
 	InpOptions(): format(FileFormat::UNKNOWN), filename(), sumdups(false), shuffle(false)
+		, mirrored(false)
 	{}
 };
 
 // Accessory File Processing types ---------------------------------------------
+//! \brief Whether the file name has the specified extension
+//!
+//! \param filename const string&  - file name
+//! \param ext const char*  - extension without the leading '.'
+//! \return bool  - the extension is present
+inline bool hasExtension(const string& filename, const char* ext) noexcept
+{
+	const size_t  extlen = strlen(ext);
+	return filename.size() > extlen + 1 && filename[filename.size() - extlen - 1] == '.'
+		&& !filename.compare(filename.size() - extlen, extlen, ext);
+}
+
 //! \brief Create specified directory if required
 //!
 //! \param dir const string&  - directory path to be created if required
@@ -186,6 +213,76 @@ public:
 
 using FileWrappers = vector<FileWrapper>;
 
+// Hierarchy Binary Snapshot ---------------------------------------------------
+//! Signature of the Hierarchy Binary Snapshot format, including the terminating '\0'
+constexpr char HBS_SIGNATURE[8] = "DAOCHBS";
+
+//! \brief Header of the Hierarchy Binary Snapshot (.hbs)
+//! \note The file consists of the following sections aligned to 8 bytes
+//! 	(the native byte order is used):
+//! 	- HbsHeader;
+//! 	- HbsLevel[levsnum]  - levels from the bottom;
+//! 	- uint32_t ids[ndsnum + clsnum]  - ids of the items: nodes and then clusters
+//! 		of each level starting from the bottom;
+//! 	- double weights[ndsnum + clsnum]  - self weights of the items;
+//! 	- uint64_t ownoffs[ndsnum + clsnum + 1]  - offsets of the item owners;
+//! 	- uint32_t owners[ownsnum]  - owner clusters as indexes in the items;
+//! 	- float shares[ownsnum]  - shares of the item in the owners if HbsFlags::SHARES.
+struct HbsHeader {
+	constexpr static uint32_t  VERSION = 1;  //!< Version of the format
+
+	char  signature[sizeof HBS_SIGNATURE];  //!< Format signature
+	uint32_t  version;  //!< Format version
+	uint32_t  flags;  //!< HbsFlags
+	uint64_t  ndsnum;  //!< The number of nodes
+	uint64_t  clsnum;  //!< The number of clusters in all levels
+	uint64_t  ownsnum;  //!< The total number of owners of all items
+	uint64_t  links;  //!< The number of node links (score().nodesLinks)
+	double  modularity;  //!< Modularity of the hierarchy (score().modularity)
+	uint32_t  levsnum;  //!< The number of levels
+	uint32_t  rootsnum;  //!< The number of root clusters
+};
+
+//! Flags of the Hierarchy Binary Snapshot
+enum HbsFlags: uint32_t {
+	HBS_NONE = 0,
+	HBS_SHARES = 1,  //!< Owner shares are stored (fuzzy overlaps)
+	HBS_EDGES = 2  //!< Links of the nodes are edges (undirected)
+};
+
+//! Level descriptor of the Hierarchy Binary Snapshot
+struct HbsLevel {
+	uint32_t  clsnum;  //!< The number of (pure) clusters in the level
+	uint32_t  fullsize;  //!< The number of clusters including the propagated ones
+};
+
+// Note: binAligned() and the Cluster Nodes Binary membership (CnbHeader) are defined
+// in cnbformat.h shared with the standalone utilities
+
+// Cluster Metrics Binary ------------------------------------------------------
+//! Signature of the Cluster Metrics Binary format, including the terminating '\0'
+constexpr char CMB_SIGNATURE[8] = "DAOCCMB";
+
+//! \brief Header of the Cluster Metrics Binary (.cmb)
+//! \note The file consists of the following columns aligned to 8 bytes
+//! 	(the native byte order is used), each row corresponds to the cluster on the level:
+//! 	- CmbHeader;
+//! 	- uint32_t levels[clsnum]  - level index of the cluster from the bottom;
+//! 	- uint32_t ids[clsnum]  - cluster ids;
+//! 	- double sizes[clsnum]  - the number of member nodes;
+//! 	- double weights[clsnum]  - internal (self) weight of the cluster;
+//! 	- double cuts[clsnum]  - weight of the external links of the cluster;
+//! 	- double densities[clsnum]  - internal weight per member node;
+//! 	- double conductances[clsnum]  - cut related to the full weight of the cluster.
+struct CmbHeader {
+	constexpr static uint32_t  VERSION = 1;  //!< Version of the format
+
+	char  signature[sizeof CMB_SIGNATURE];  //!< Format signature
+	uint32_t  version;  //!< Format version
+	uint32_t  levsnum;  //!< The number of levels in the hierarchy
+	uint64_t  clsnum;  //!< The number of rows (clusters on the levels)
+};
+
 }  // daoc
 
 #endif // IOTYPES_H
@@ -0,0 +1,164 @@
+//! \brief Read-only memory mapped file.
+//! The Dao (Deterministic Agglomerative Overlapping) of Clustering library:
+//! Robust & Fine-grained Deterministic Clustering for Large Networks.
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#ifndef MAPPED_HPP
+#define MAPPED_HPP
+
+#include <cstdio>
+#include <cstdint>  // uint8_t
+#include <ios>  // ios_base::failure
+#include <vector>
+
+#ifdef __unix__
+#include <sys/mman.h>  // mmap
+#include <sys/stat.h>  // fstat
+#include <fcntl.h>  // open
+#include <unistd.h>  // close
+#endif // __unix__
+
+#include "fileio/iotypes.h"
+
+
+namespace daoc {
+
+//! \brief Read-only memory mapped file
+//! \note The file is loaded into the memory buffer if mmap is not available
+class MappedFile {
+	const uint8_t*  m_data;  //!< Mapped content
+	size_t  m_size;  //!< Size of the content in bytes
+#ifndef __unix__
+	vector<uint8_t>  m_buf;  //!< Loaded content if the mapping is not supported
+#endif // __unix__
+public:
+	//! \brief Default constructor
+	MappedFile() noexcept: m_data(nullptr), m_size(0)
+#ifndef __unix__
+		, m_buf()
+#endif // __unix__
+	{}
+
+	//! \brief Map the specified file
+	//! \note Throws ios_base::failure on the mapping failure
+	//!
+	//! \param filename const string&  - the file to be mapped
+	explicit MappedFile(const string& filename): MappedFile()
+	{ open(filename); }
+
+	MappedFile(const MappedFile&)=delete;
+	MappedFile& operator= (const MappedFile&)=delete;
+
+	//! \brief Move constructor
+	MappedFile(MappedFile&& mf) noexcept: MappedFile()
+	{ *this = std::move(mf); }
+
+	//! \brief Move assignment
+	MappedFile& operator= (MappedFile&& mf) noexcept
+	{
+		close();
+		m_data = mf.m_data;
+		m_size = mf.m_size;
+#ifndef __unix__
+		m_buf = std::move(mf.m_buf);
+#endif // __unix__
+		mf.m_data = nullptr;
+		mf.m_size = 0;
+		return *this;
+	}
+
+	//! \brief Destructor
+	~MappedFile()  { close(); }
+
+	//! \brief Map the specified file, unmapping the previous one
+	//! \note Throws ios_base::failure on the mapping failure
+	//!
+	//! \param filename const string&  - the file to be mapped
+	//! \return void
+	void open(const string& filename);
+
+	//! \brief Unmap the file
+	void close() noexcept;
+
+	//! \brief Mapped content
+	const uint8_t* data() const noexcept  { return m_data; }
+
+	//! \brief Size of the mapped content in bytes
+	size_t size() const noexcept  { return m_size; }
+
+	//! \brief Whether the file is mapped
+	explicit operator bool() const noexcept  { return m_data; }
+};
+
+// MappedFile definition -------------------------------------------------------
+inline void MappedFile::open(const string& filename)
+{
+	close();
+#ifdef __unix__
+	const int  fd = ::open(filename.c_str(), O_RDONLY);
+	if(fd == -1)
+		throw std::ios_base::failure(string("ERROR open(), the file can't be opened: ")
+			.append(filename) += '\n');
+	struct stat  filest;
+	if(fstat(fd, &filest)) {
+		::close(fd);
+		throw std::ios_base::failure(string("ERROR open(), the file size can't be evaluated: ")
+			.append(filename) += '\n');
+	}
+	m_size = filest.st_size;
+	if(m_size) {
+		void*  data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(data == MAP_FAILED) {
+			::close(fd);
+			m_size = 0;
+			throw std::ios_base::failure(string("ERROR open(), the file can't be mapped: ")
+				.append(filename) += '\n');
+		}
+		// Note: the content is mostly traversed sequentially
+		madvise(data, m_size, MADV_SEQUENTIAL);
+		m_data = static_cast<const uint8_t*>(data);
+	}
+	// Note: the mapping remains valid after the file descriptor closing
+	::close(fd);
+#else
+	FileWrapper  fin(fopen(filename.c_str(), "rb"));
+	if(!fin)
+		throw std::ios_base::failure(string("ERROR open(), the file can't be opened: ")
+			.append(filename) += '\n');
+	fseek(fin, 0, SEEK_END);
+	m_size = ftell(fin);
+	rewind(fin);
+	m_buf.resize(m_size);
+	if(fread(m_buf.data(), 1, m_size, fin) != m_size) {
+		m_buf.clear();
+		m_size = 0;
+		throw std::ios_base::failure(string("ERROR open(), the file can't be loaded: ")
+			.append(filename) += '\n');
+	}
+	m_data = m_buf.data();
+#endif // __unix__
+}
+
+inline void MappedFile::close() noexcept
+{
+#ifdef __unix__
+	if(m_data)
+		munmap(const_cast<uint8_t*>(m_data), m_size);
+#else
+	m_buf.clear();
+	m_buf.shrink_to_fit();
+#endif // __unix__
+	m_data = nullptr;
+	m_size = 0;
+}
+
+}  // daoc
+
+#endif // MAPPED_HPP
@@ -0,0 +1,83 @@
+//! \brief Cluster Nodes Binary membership (.cnb) parser.
+//! The Dao (Deterministic Agglomerative Overlapping) of Clustering library:
+//! Robust & Fine-grained Deterministic Clustering for Large Networks.
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#ifndef PARSER_CNB_H
+#define PARSER_CNB_H
+
+#include "fileio/iotypes.h"
+#include "fileio/mapped.hpp"
+#include "types.h"  // common types
+
+
+namespace daoc {
+
+//! \brief Cluster Nodes Binary membership parser
+//! \note The file is memory mapped and its sections are exposed as flat arrays
+//! 	without any copying, see CnbHeader for the layout. The arrays are valid
+//! 	while the parser exists. The parser is interchangeable with CnlParser
+//! 	in loadClusters<ParserT>().
+class CnbParser {
+	MappedFile  m_file;  //!< Mapped membership
+	const CnbHeader*  m_header;  //!< Membership header
+	const uint32_t*  m_cids;  //!< Cluster ids, nullptr if not stored
+	const uint64_t*  m_offsets;  //!< Offsets of the cluster members, clsnum + 1
+	const uint32_t*  m_members;  //!< Member node ids of the clusters
+	const float*  m_shares;  //!< Shares of the members, nullptr if not stored
+public:
+    //! \brief Parser constructor
+    //! \note Throws ios_base::failure on the file mapping failure and
+    //! 	invalid_argument if the file is not a valid binary membership
+    //!
+    //! \param filename const string&  - input file to be processed
+	CnbParser(const string& filename);
+
+	//! \brief Whether node shares are specified
+	bool fuzzy() const noexcept  { return m_shares; }
+
+	//! \brief Membership header
+	const CnbHeader& header() const noexcept  { return *m_header; }
+
+	//! \copydoc m_cids
+	const uint32_t* cids() const noexcept  { return m_cids; }
+
+	//! \copydoc m_offsets
+	const uint64_t* offsets() const noexcept  { return m_offsets; }
+
+	//! \copydoc m_members
+	const uint32_t* members() const noexcept  { return m_members; }
+
+	//! \copydoc m_shares
+	const float* shares() const noexcept  { return m_shares; }
+
+    //! \brief Build clusters from the underlying file
+    //! Constructs clusters and initializes their attributes the same way as
+    //! CnlParser::build() does
+    //! \attention des of clusters are NOT ordered
+    //! \post Updates owners of the graph nodes
+    //! \note The member nodes missed in the graph are skipped and reported
+    //!
+    //! \param idnodes IdItems<Node<LinksT>>&  - mapping of the node ids into the nodes
+    //! \return shared_ptr<RawMembership<LinksT>>  - parsed raw membership
+    //! 	(cluster links are not built)
+	template <typename LinksT>
+	shared_ptr<RawMembership<LinksT>> build(
+#ifndef SWIG
+		IdItems<Node<LinksT>>
+#else
+		IdItems(Node<LinksT>)
+#endif // SWIG
+		& idnodes) const;
+};
+
+}  // daoc
+
+#endif // PARSER_CNB_H
@@ -0,0 +1,129 @@
+//! \brief Cluster Nodes Binary membership (.cnb) parser.
+//! The Dao (Deterministic Agglomerative Overlapping) of Clustering library:
+//! Robust & Fine-grained Deterministic Clustering for Large Networks.
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#ifndef PARSER_CNB_HPP
+#define PARSER_CNB_HPP
+
+#include <cstring>  // memcmp
+#include <stdexcept>  // invalid_argument
+
+#include "operations.hpp"  // bsObjsDest
+#include "fileio/parser_cnb.h"
+
+
+namespace daoc {
+
+using std::invalid_argument;
+
+// CnbParser -------------------------------------------------------------------
+inline CnbParser::CnbParser(const string& filename)
+: m_file(filename), m_header(nullptr), m_cids(nullptr), m_offsets(nullptr)
+, m_members(nullptr), m_shares(nullptr)
+{
+	const uint8_t*  data = m_file.data();
+	if(m_file.size() < sizeof(CnbHeader))
+		throw invalid_argument(string("CnbParser(), the file is too small to be a binary membership: ")
+			.append(filename) += '\n');
+	m_header = reinterpret_cast<const CnbHeader*>(data);
+	if(memcmp(m_header->signature, CNB_SIGNATURE, sizeof CNB_SIGNATURE))
+		throw invalid_argument(string("CnbParser(), the file is not a binary membership: ")
+			.append(filename) += '\n');
+	if(m_header->version != CnbHeader::VERSION)
+		throw invalid_argument(string("CnbParser(), unsupported format version ")
+			.append(std::to_string(m_header->version)).append(": ").append(filename) += '\n');
+
+	// Evaluate offsets of the sections
+	const uint64_t  clsnum = m_header->clsnum;
+	const uint64_t  mbsnum = m_header->mbsnum;
+	uint64_t  pos = binAligned(sizeof(CnbHeader));
+	const uint64_t  poscids = pos;
+	if(m_header->flags & CNB_NUMBERED)
+		pos += binAligned(clsnum * sizeof(uint32_t));
+	const uint64_t  posoffsets = pos;
+	pos += (clsnum + 1) * sizeof(uint64_t);
+	const uint64_t  posmembers = pos;
+	pos += binAligned(mbsnum * sizeof(uint32_t));
+	const uint64_t  posshares = pos;
+	if(m_header->flags & CNB_SHARES)
+		pos += binAligned(mbsnum * sizeof(float));
+	if(pos != m_file.size())
+		throw invalid_argument(string("CnbParser(), the file size is inconsistent with its header: ")
+			.append(filename) += '\n');
+
+	if(m_header->flags & CNB_NUMBERED)
+		m_cids = reinterpret_cast<const uint32_t*>(data + poscids);
+	m_offsets = reinterpret_cast<const uint64_t*>(data + posoffsets);
+	m_members = reinterpret_cast<const uint32_t*>(data + posmembers);
+	if(m_header->flags & CNB_SHARES)
+		m_shares = reinterpret_cast<const float*>(data + posshares);
+	// Validate the member offsets: they start from zero, are ordered and bounded
+	if(m_offsets[0] || m_offsets[clsnum] != mbsnum)
+		throw invalid_argument(string("CnbParser(), the member offsets are corrupted: ")
+			.append(filename) += '\n');
+	for(uint64_t i = 0; i < clsnum; ++i)
+		if(m_offsets[i] > m_offsets[i + 1] || m_offsets[i + 1] > mbsnum)
+			throw invalid_argument(string("CnbParser(), the member offsets are corrupted: ")
+				.append(filename) += '\n');
+}
+
+template <typename LinksT>
+shared_ptr<RawMembership<LinksT>> CnbParser::build(IdItems<Node<LinksT>>& idnodes) const
+{
+	const uint64_t  clsnum = m_header->clsnum;
+	RawMembership<LinksT>  msp;  // Forming raw (cluster links are not built) membership
+	if(m_shares && m_header->ndsnum)
+		msp.ndshares.reserve(m_header->ndsnum);
+
+	StructNodeErrors  nderrs("WARNING build(), the member nodes missed in the graph are skipped: ");
+	for(uint64_t icl = 0; icl < clsnum; ++icl) {
+		if(m_cids)
+			msp.clusters.emplace_back(0, m_cids[icl], 0);
+		else msp.clusters.emplace_back(0);
+		auto& cl = msp.clusters.back();
+		const uint64_t  imbe = m_offsets[icl + 1];  // Note: the offsets are validated on construction
+		for(uint64_t imb = m_offsets[icl]; imb < imbe; ++imb) {
+			// Skip the nodes missed in the graph with their shares
+			const auto  ind = idnodes.find(m_members[imb]);
+			if(ind == idnodes.end() || !ind->second) {
+				nderrs.add(m_members[imb]);
+				continue;
+			}
+			auto& node = *ind->second;
+			// Update node owners
+			// ATTENTION: Owners must be ordered
+			if(node.owners.empty())
+				node.owners.emplace_back(&cl);
+			else node.owners.emplace(linear_ifind(node.owners, &cl
+				, bsObjsDest<Owners<LinksT>>), &cl);
+			// Update cluster descendants
+			cl.des.push_back(&node);  // Note: des are intentionally not ordered here
+			// Save the share only if it is specified and might be unequal
+			if(m_shares && m_shares[imb] && m_shares[imb] != 1) {
+				const Share  share = m_shares[imb];
+				auto& nodeShares = msp.ndshares[&node];
+				nodeShares.emplace(insorted(nodeShares, &cl
+					, bsObjsDest<NodeShares<LinksT>>), &cl, share);
+			}
+		}
+	}
+	nderrs.show();
+#if TRACE >= 2
+	fprintf(ftrace, "> build(), %lu clusters loaded from the binary membership\n"
+		, msp.clusters.size());
+#endif // TRACE
+
+	return make_shared<RawMembership<LinksT>>(move(msp));
+}
+
+}  // daoc
+
+#endif // PARSER_CNB_HPP
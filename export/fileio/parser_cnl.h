@@ -60,6 +60,22 @@ protected:
 	//! \attention Only whole line comments are supported, not in-line
 	constexpr static char  m_comment = '#';
 
+#ifndef SWIG
+	//! Min size of the input file in bytes per worker to build clusters in parallel
+	constexpr static size_t  m_parchunk = 1 << 20;
+
+    //! \brief Build clusters from the underlying file in parallel
+    //! Chunks of the remained file content are parsed into the per-cluster member
+    //! arrays in parallel, which are inverted into the ordered owners of nodes by
+    //! the parallel counting sort. The results are the same as build() has.
+    //!
+    //! \param idnodes IdItems<Node<LinksT>>&  - mapping of the node ids into the nodes
+    //! \param workers unsigned  - the number of workers, >= 2
+    //! \return shared_ptr<RawMembership<LinksT>>  - parsed raw membership
+	template <typename LinksT>
+	shared_ptr<RawMembership<LinksT>> buildParallel(IdItems<Node<LinksT>>& idnodes, unsigned workers);
+#endif // SWIG
+
     //! \brief Parse header of the input file to load meta-information
     //! \post Initializes: m_clsnum, m_ndsnum, m_fuzzy, m_numbered
 	//!
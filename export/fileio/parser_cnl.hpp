@@ -17,7 +17,14 @@
 #include <set>
 #endif // VALIDATE
 
+#include <atomic>
+#include <memory>  // unique_ptr
+#include <iterator>  // istreambuf_iterator
+#include <algorithm>  // sort
+
 #include "operations.hpp"  // bsObjsDest
+#include "flathash.hpp"  // FlatHashMap
+#include "parallel.hpp"  // workersNum, parallelRanges
 #include "fileio/rawparse.hpp"
 #include "fileio/parser_cnl.h"
 
@@ -26,6 +33,8 @@ namespace daoc {
 
 using std::common_type;
 using std::min;
+using std::atomic;
+using std::unique_ptr;
 #if VALIDATE >= 2
 using std::set;
 #endif // VALIDATE
@@ -45,6 +54,13 @@ shared_ptr<RawMembership<LinksT>> CnlParser::build(IdItems<Node<LinksT>>& idnode
 		return val <= 0 || val > 1 || !strchr(m_spaces, end);  // Share E (0, 1]
 	};
 
+	// Build large clusterings in parallel
+	if(m_size != size_t(-1) && m_size >= 2 * m_parchunk) {
+		const unsigned  workers = workersNum(m_size, m_parchunk);
+		if(workers >= 2)
+			return buildParallel(idnodes, workers);
+	}
+
 	RawMembership<LinksT>  msp;  // Forming raw (cluster links are not built) membership
 	// Reserve the number of nodes if possible
 	{
@@ -81,6 +97,7 @@ shared_ptr<RawMembership<LinksT>> CnlParser::build(IdItems<Node<LinksT>>& idnode
 #if TRACE >= 2
 	Id lines = 0;  // The number of valuable lines processed
 #endif // TRACE
+	StructNodeErrors  nderrs("WARNING build(), the member nodes missed in the graph are skipped: ");
 	do {
 		char* str = const_cast<char*>(m_line.c_str());
 #if TRACE >= 3
@@ -107,8 +124,16 @@ shared_ptr<RawMembership<LinksT>> CnlParser::build(IdItems<Node<LinksT>>& idnode
 #endif // VALIDATE
 		while(skipSymbols(str, m_spaces)) {
 			Id  nid = parseVal<Id>(str, strtoul, invalNid, "Node id is invalid");
+			// Skip the nodes missed in the graph with their shares
+			const auto  ind = idnodes.find(nid);
+			if(ind == idnodes.end() || !ind->second) {
+				nderrs.add(nid);
+				if(*str == ':')
+					parseVal<Share>(++str, strtof, invalShare, "The share is invalid");  // Note: ++str to skip ':'
+				continue;
+			}
 			// Add read node to the cluster and update node owners
-			auto& node = *idnodes[nid];
+			auto& node = *ind->second;
 			// Update node owners
 			// ATTENTION: Owners must be ordered
 			if(node.owners.empty())
@@ -140,6 +165,7 @@ shared_ptr<RawMembership<LinksT>> CnlParser::build(IdItems<Node<LinksT>>& idnode
 			fprintf(ftrace, "> WARNING build(), member nodes are not specified for the #%u\n", cl.id);
 #endif // TRACE
 	} while(getline(m_infile, m_line));
+	nderrs.show();
 #if VALIDATE >= 1
 #if VALIDATE >= 2
 	assert(msp.clusters.size() == cids.size()
@@ -160,6 +186,253 @@ shared_ptr<RawMembership<LinksT>> CnlParser::build(IdItems<Node<LinksT>>& idnode
 	return make_shared<RawMembership<LinksT>>(move(msp));
 }
 
+template <typename LinksT>
+shared_ptr<RawMembership<LinksT>> CnlParser::buildParallel(IdItems<Node<LinksT>>& idnodes, unsigned workers)
+{
+	constexpr auto invalCid = [](Id val, char end) noexcept -> bool {
+		return val == ID_NONE || end != '>';  // Next char should be '>'
+	};
+	auto invalNid = [](Id val, char end) noexcept -> bool {
+		return val == ID_NONE || !strchr(" \t:", end);
+	};
+	auto invalShare = [](Share val, char end) noexcept -> bool {
+		return val <= 0 || val > 1 || !strchr(m_spaces, end);  // Share E (0, 1]
+	};
+	using ClusterPtrs = vector<Cluster<LinksT>*>;
+	using NodePtrs = vector<Node<LinksT>*>;
+
+	// Load the remained content of the file including the already read line
+	string  text(m_line);
+	text += '\n';
+	{
+		const auto  pos = m_infile.tellg();
+		const size_t  ibeg = text.size();
+		if(pos >= 0 && m_size > size_t(pos)) {
+			text.resize(ibeg + m_size - pos);
+			m_infile.read(&text[ibeg], m_size - pos);
+			text.resize(ibeg + m_infile.gcount());
+		}
+		// Note: the file might be extended after its size evaluation
+		text.append(std::istreambuf_iterator<char>(m_infile), std::istreambuf_iterator<char>());
+	}
+	// Split the content into chunks by lines
+	vector<size_t>  bounds(workers + 1, text.size());  // Bounds of the chunks
+	bounds[0] = 0;
+	for(unsigned ic = 1; ic < workers; ++ic) {
+		size_t  pos = std::max<size_t>(text.size() * ic / workers, bounds[ic - 1]);
+		pos = text.find('\n', pos);
+		bounds[ic] = pos != string::npos ? pos + 1 : text.size();
+	}
+
+	// Index the nodes to be able to invert the membership by the counting sort
+	NodePtrs  nodes;
+	nodes.reserve(idnodes.size());
+	FlatHashMap<Id, Id>  ndinds(idnodes.size());  // Node indexes by the ids
+	for(auto& idn: idnodes) {
+		// Note: the null nodes are skipped as in build() and reported as missed on parsing
+		if(!idn.second)
+			continue;
+		ndinds.emplace(idn.first, nodes.size());
+		nodes.push_back(&*idn.second);
+	}
+
+	//! Parsed chunk of the clusters
+	struct Chunk {
+		vector<Id>  cids;  //!< Cluster ids if numbered
+		vector<size_t>  offsets;  //!< Offsets of the cluster members
+		vector<Id>  members;  //!< Indexes of the member nodes
+		vector<Share>  shares;  //!< Shares of the members if any is specified, 0 means unspecified
+		vector<Id>  skipped;  //!< Ids of the skipped member nodes missed in the graph
+	};
+	vector<Chunk>  chunks(workers);
+	// Parse the chunks in parallel
+	parallelRanges(workers, [&](size_t ib, size_t ie, unsigned) {
+		for(size_t ic = ib; ic < ie; ++ic) {
+			auto&  chunk = chunks[ic];
+			chunk.offsets.push_back(0);
+			char*  line = &text[bounds[ic]];
+			char* const  end = &text[0] + bounds[ic + 1];
+			while(line < end) {
+				char*  eol = static_cast<char*>(memchr(line, '\n', end - line));
+				if(!eol)
+					eol = end;
+				*eol = 0;  // Note: either '\n' or the terminating 0 of the text is replaced
+				char*  str = line;
+				line = eol + 1;
+				// Skip empty and space lines, skip comments
+				if(!skipSymbols(str, m_spaces) || *str == m_comment)
+					continue;
+				// Parse cluster id if required
+				if(m_numbered) {
+					chunk.cids.push_back(parseVal<Id>(str, strtoul, invalCid, "Cluster id is invalid"));
+					++str;  // Skip '>'
+				}
+				// Parse node ids
+				while(skipSymbols(str, m_spaces)) {
+					const Id  nid = parseVal<Id>(str, strtoul, invalNid, "Node id is invalid");
+					// Skip the nodes missed in the graph with their shares
+					const auto  ind = ndinds.find(nid);
+					if(ind == ndinds.end()) {
+						chunk.skipped.push_back(nid);
+						if(*str == ':')
+							parseVal<Share>(++str, strtof, invalShare, "The share is invalid");  // Note: ++str to skip ':'
+						continue;
+					}
+					chunk.members.push_back(ind->second);
+					// Check for the ':' and read node share if required
+					if(*str == ':') {
+#if VALIDATE >= 2
+						assert(m_fuzzy && "buildParallel(), shares should be specified only for the"
+							" fuzzy (unequal overlapping) clustering");
+#endif // VALIDATE
+						// Note: shares are allocated on the first specified share
+						chunk.shares.resize(chunk.members.size());
+						chunk.shares.back() = parseVal<Share>(++str, strtof, invalShare, "The share is invalid");  // Note: ++str to skip ':'
+					} else if(!chunk.shares.empty())
+						chunk.shares.push_back(0);
+				}
+				chunk.offsets.push_back(chunk.members.size());
+			}
+		}
+	}, workers);
+
+	{
+		// Note: the same as build(), the missed nodes are reported in the order of the file
+		StructNodeErrors  nderrs("WARNING buildParallel(), the member nodes missed in the graph are skipped: ");
+		for(const auto& chunk: chunks)
+			for(auto nid: chunk.skipped)
+				nderrs.add(nid);
+		nderrs.show();
+	}
+
+	// Form the clusters preserving their order in the file
+	RawMembership<LinksT>  msp;  // Forming raw (cluster links are not built) membership
+	vector<size_t>  clbases(workers + 1, 0);  // Global index of the first cluster of each chunk
+	for(unsigned ic = 0; ic < workers; ++ic)
+		clbases[ic + 1] = clbases[ic] + chunks[ic].offsets.size() - 1;
+	ClusterPtrs  cls;
+	cls.reserve(clbases.back());
+	bool  fuzzy = false;  // Whether any share is specified
+	for(const auto& chunk: chunks) {
+		fuzzy = fuzzy || !chunk.shares.empty();
+		for(size_t icl = 0; icl + 1 < chunk.offsets.size(); ++icl) {
+			if(m_numbered)
+				msp.clusters.emplace_back(0, chunk.cids[icl], 0);
+			else msp.clusters.emplace_back(0);
+			cls.push_back(&msp.clusters.back());
+		}
+	}
+
+	// Fill the cluster descendants and count the owners of each node
+	const size_t  ndsnum = nodes.size();
+	unique_ptr<atomic<size_t>[]>  cursors(new atomic<size_t>[ndsnum]);
+	for(size_t i = 0; i < ndsnum; ++i)
+		cursors[i].store(0, std::memory_order_relaxed);
+	parallelRanges(workers, [&](size_t ib, size_t ie, unsigned) {
+		for(size_t ic = ib; ic < ie; ++ic) {
+			const auto&  chunk = chunks[ic];
+			for(size_t icl = 0; icl + 1 < chunk.offsets.size(); ++icl) {
+				auto&  cl = *cls[clbases[ic] + icl];
+				for(size_t im = chunk.offsets[icl]; im < chunk.offsets[icl + 1]; ++im) {
+					cl.des.push_back(nodes[chunk.members[im]]);  // Note: des are intentionally not ordered here
+					cursors[chunk.members[im]].fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		}
+	}, workers);
+	// Offsets of the owners of each node
+	vector<size_t>  ownoffs(ndsnum + 1);
+	ownoffs[0] = 0;
+	for(size_t i = 0; i < ndsnum; ++i) {
+		ownoffs[i + 1] = ownoffs[i] + cursors[i].load(std::memory_order_relaxed);
+		cursors[i].store(ownoffs[i], std::memory_order_relaxed);
+	}
+	// Scatter the owner clusters of the nodes
+	vector<size_t>  owncls(ownoffs.back());  // Global indexes of the owner clusters
+	vector<Share>  ownshares(fuzzy ? ownoffs.back() : 0);  // Shares of the nodes in the owners
+	parallelRanges(workers, [&](size_t ib, size_t ie, unsigned) {
+		for(size_t ic = ib; ic < ie; ++ic) {
+			const auto&  chunk = chunks[ic];
+			for(size_t icl = 0; icl + 1 < chunk.offsets.size(); ++icl)
+				for(size_t im = chunk.offsets[icl]; im < chunk.offsets[icl + 1]; ++im) {
+					const size_t  pos = cursors[chunk.members[im]].fetch_add(1, std::memory_order_relaxed);
+					owncls[pos] = clbases[ic] + icl;
+					if(!chunk.shares.empty())
+						ownshares[pos] = chunk.shares[im];
+				}
+		}
+	}, workers);
+	cursors.reset();
+	chunks.clear();
+	text.clear();
+
+	// Form the ordered owners of each node
+	vector<vector<size_t>>  shnodes(workers);  // Indexes of the nodes having specified shares
+	parallelRanges(ndsnum, [&](size_t ib, size_t ie, unsigned iw) {
+		//! Compare owners by the cluster address, which is the order of the owners
+		auto clsLess = [&cls](size_t a, size_t b) noexcept -> bool {
+			return std::less<const Cluster<LinksT>*>()(cls[a], cls[b]);
+		};
+		vector<std::pair<size_t, Share>>  clshares;  // Owner clusters with the shares
+		for(size_t ind = ib; ind < ie; ++ind) {
+			const size_t  ob = ownoffs[ind];
+			const size_t  oe = ownoffs[ind + 1];
+			if(ob == oe)
+				continue;
+			// Order the owners preserving the corresponding shares
+			if(fuzzy) {
+				clshares.clear();
+				bool  shared = false;  // Whether any share is specified
+				for(size_t io = ob; io < oe; ++io) {
+					clshares.emplace_back(owncls[io], ownshares[io]);
+					shared = shared || (ownshares[io] && ownshares[io] != 1);
+				}
+				std::stable_sort(clshares.begin(), clshares.end(), [&clsLess](const std::pair<size_t, Share>& a
+				, const std::pair<size_t, Share>& b) noexcept { return clsLess(a.first, b.first); });
+				for(size_t io = ob; io < oe; ++io) {
+					owncls[io] = clshares[io - ob].first;
+					ownshares[io] = clshares[io - ob].second;
+				}
+				if(shared)
+					shnodes[iw].push_back(ind);
+			} else std::stable_sort(owncls.begin() + ob, owncls.begin() + oe, clsLess);
+			// Update node owners
+			// ATTENTION: Owners must be ordered
+			auto&  owners = nodes[ind]->owners;
+			if(owners.empty()) {
+				owners.reserve(oe - ob);
+				for(size_t io = ob; io < oe; ++io)
+					owners.emplace_back(cls[owncls[io]]);
+			} else for(size_t io = ob; io < oe; ++io)
+				owners.emplace(linear_ifind(owners, cls[owncls[io]]
+					, bsObjsDest<Owners<LinksT>>), cls[owncls[io]]);
+		}
+	}, workers);
+	// Save the unequal shares of the nodes
+	for(const auto& wshnodes: shnodes)
+		for(auto ind: wshnodes) {
+			auto&  nodeShares = msp.ndshares[nodes[ind]];
+			for(size_t io = ownoffs[ind]; io < ownoffs[ind + 1]; ++io) {
+				const Share  share = ownshares[io];
+				if(!share || share == 1)
+					continue;
+				auto  cl = cls[owncls[io]];
+				nodeShares.emplace(insorted(nodeShares, cl, bsObjsDest<NodeShares<LinksT>>), cl, share);
+			}
+			assert(nodeShares.size() <= nodes[ind]->owners.size()
+				&& "buildParallel(), unequal shares should be specified at most for all owners of the node");
+		}
+#if VALIDATE >= 1
+	assert((!m_clsnum || msp.clusters.size() == m_clsnum) && "buildParallel(), clusters size validation failed");
+#endif // VALIDATE
+#if TRACE >= 2
+	fprintf(ftrace, "> buildParallel(), %lu clusters loaded by %u workers\n"
+		, msp.clusters.size(), workers);
+#endif // TRACE
+
+	return make_shared<RawMembership<LinksT>>(move(msp));
+}
+
 }  // daoc
 
 #endif // PARSER_CNL_HPP
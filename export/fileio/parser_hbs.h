@@ -0,0 +1,82 @@
+//! \brief Hierarchy Binary Snapshot (.hbs) parser.
+//! The Dao (Deterministic Agglomerative Overlapping) of Clustering library:
+//! Robust & Fine-grained Deterministic Clustering for Large Networks.
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#ifndef PARSER_HBS_H
+#define PARSER_HBS_H
+
+#include "fileio/iotypes.h"
+#include "fileio/mapped.hpp"
+
+
+namespace daoc {
+
+//! \brief Hierarchy Binary Snapshot parser
+//! \note The snapshot is memory mapped and its sections are exposed as
+//! 	flat arrays without any copying, see HbsHeader for the layout.
+//! 	The arrays are valid while the parser exists. The sections are validated
+//! 	on loading, so the owner indexes and offsets are within the sections bounds.
+class HbsParser {
+	MappedFile  m_file;  //!< Mapped snapshot
+	const HbsHeader*  m_header;  //!< Snapshot header
+	const HbsLevel*  m_levels;  //!< Levels from the bottom
+	const uint32_t*  m_ids;  //!< Ids of the items: nodes and then clusters from the bottom level
+	const double*  m_weights;  //!< Weights of the items
+	const uint64_t*  m_ownoffs;  //!< Offsets of the item owners, items + 1
+	const uint32_t*  m_owners;  //!< Owners as indexes of the items
+	const float*  m_shares;  //!< Shares of the items in the owners, nullptr if not stored
+public:
+    //! \brief Parser constructor
+    //! \note Throws ios_base::failure on the file mapping failure and
+    //! 	invalid_argument if the file is not a valid snapshot
+    //!
+    //! \param filename const string&  - snapshot file to be loaded
+	HbsParser(const string& filename);
+
+	//! \brief Snapshot header
+	const HbsHeader& header() const noexcept  { return *m_header; }
+
+	//! \brief The number of items: nodes and clusters
+	uint64_t items() const noexcept  { return m_header->ndsnum + m_header->clsnum; }
+
+	//! \copydoc m_levels
+	const HbsLevel* levels() const noexcept  { return m_levels; }
+
+	//! \copydoc m_ids
+	const uint32_t* ids() const noexcept  { return m_ids; }
+
+	//! \copydoc m_weights
+	const double* weights() const noexcept  { return m_weights; }
+
+	//! \copydoc m_ownoffs
+	const uint64_t* ownoffs() const noexcept  { return m_ownoffs; }
+
+	//! \copydoc m_owners
+	const uint32_t* owners() const noexcept  { return m_owners; }
+
+	//! \copydoc m_shares
+	const float* shares() const noexcept  { return m_shares; }
+
+    //! \brief Output the snapshot clusters unwrapped to the member nodes in the CNL format
+    //! \note Throws invalid_argument for the output structures other than ROOT, ALLCLS
+    //! 	and PERLEVEL. MAXSHARE is not supported and ignored.
+    //!
+    //! \param fouts FileWrappers&  - output files: a single one for the ROOT and ALLCLS
+    //! 	output structures or one per level from the bottom for PERLEVEL
+    //! \param clsfmt ClsOutFmtBase  - cluster output format
+    //! \param fltMembers=false bool  - filter out nodes having the highest bit of the id set
+    //! \return void
+	void output(FileWrappers& fouts, ClsOutFmtBase clsfmt, bool fltMembers=false) const;
+};
+
+}  // daoc
+
+#endif // PARSER_HBS_H
@@ -0,0 +1,243 @@
+//! \brief Hierarchy Binary Snapshot (.hbs) parser.
+//! The Dao (Deterministic Agglomerative Overlapping) of Clustering library:
+//! Robust & Fine-grained Deterministic Clustering for Large Networks.
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#ifndef PARSER_HBS_HPP
+#define PARSER_HBS_HPP
+
+#include <cstring>  // memcmp
+#include <cstdint>  // UINT32_MAX
+#include <stdexcept>  // invalid_argument
+#include <utility>  // pair
+#include <algorithm>  // sort
+
+#include "operations.hpp"  // equalx
+#include "fileio/parser_hbs.h"
+
+
+namespace daoc {
+
+using std::invalid_argument;
+using std::pair;
+
+// HbsParser -------------------------------------------------------------------
+inline HbsParser::HbsParser(const string& filename)
+: m_file(filename), m_header(nullptr), m_levels(nullptr), m_ids(nullptr), m_weights(nullptr)
+, m_ownoffs(nullptr), m_owners(nullptr), m_shares(nullptr)
+{
+	const uint8_t*  data = m_file.data();
+	if(m_file.size() < sizeof(HbsHeader))
+		throw invalid_argument(string("HbsParser(), the file is too small to be a snapshot: ")
+			.append(filename) += '\n');
+	m_header = reinterpret_cast<const HbsHeader*>(data);
+	if(memcmp(m_header->signature, HBS_SIGNATURE, sizeof HBS_SIGNATURE))
+		throw invalid_argument(string("HbsParser(), the file is not a hierarchy snapshot: ")
+			.append(filename) += '\n');
+	if(m_header->version != HbsHeader::VERSION)
+		throw invalid_argument(string("HbsParser(), unsupported snapshot version ")
+			.append(std::to_string(m_header->version)).append(": ").append(filename) += '\n');
+
+	// Evaluate offsets of the sections
+	// Note: the item and owner indexes are uint32_t
+	const uint64_t  ndsnum = m_header->ndsnum;
+	if(ndsnum > UINT32_MAX || m_header->clsnum > UINT32_MAX - ndsnum)
+		throw invalid_argument(string("HbsParser(), the number of items exceeds the index range: ")
+			.append(filename) += '\n');
+	const uint64_t  itsnum = items();
+	const uint64_t  ownsnum = m_header->ownsnum;
+	uint64_t  pos = binAligned(sizeof(HbsHeader));
+	//! Reserve the section, throwing on the size overflow or truncated snapshot
+	auto reserve = [&pos, &filename, fsize = uint64_t(m_file.size())](uint64_t num, uint64_t itsize
+	, bool aligned=true) -> uint64_t {
+		if(pos > fsize || num > (fsize - pos) / itsize)
+			throw invalid_argument(string("HbsParser(), the snapshot is truncated: ")
+				.append(filename) += '\n');
+		const uint64_t  spos = pos;
+		pos += aligned ? binAligned(num * itsize) : num * itsize;
+		return spos;
+	};
+	const uint64_t  poslevs = reserve(m_header->levsnum, sizeof(HbsLevel));
+	const uint64_t  posids = reserve(itsnum, sizeof(uint32_t));
+	const uint64_t  posweights = reserve(itsnum, sizeof(double), false);
+	const uint64_t  posownoffs = reserve(itsnum + 1, sizeof(uint64_t), false);
+	const uint64_t  posowners = reserve(ownsnum, sizeof(uint32_t));
+	uint64_t  posshares = pos;
+	if(m_header->flags & HBS_SHARES)
+		posshares = reserve(ownsnum, sizeof(float));
+	if(pos != m_file.size())
+		throw invalid_argument(string("HbsParser(), the snapshot size is inconsistent with its header: ")
+			.append(filename) += '\n');
+
+	m_levels = reinterpret_cast<const HbsLevel*>(data + poslevs);
+	m_ids = reinterpret_cast<const uint32_t*>(data + posids);
+	m_weights = reinterpret_cast<const double*>(data + posweights);
+	m_ownoffs = reinterpret_cast<const uint64_t*>(data + posownoffs);
+	m_owners = reinterpret_cast<const uint32_t*>(data + posowners);
+	if(m_header->flags & HBS_SHARES)
+		m_shares = reinterpret_cast<const float*>(data + posshares);
+
+	// Validate the levels
+	uint64_t  lvclsnum = 0;  // The number of clusters in the levels
+	for(uint32_t i = 0; i < m_header->levsnum; ++i) {
+		if(m_levels[i].fullsize < m_levels[i].clsnum)
+			throw invalid_argument(string("HbsParser(), the levels are corrupted: ")
+				.append(filename) += '\n');
+		lvclsnum += m_levels[i].clsnum;
+	}
+	if(lvclsnum != m_header->clsnum || (m_header->levsnum
+	&& m_header->rootsnum > m_levels[m_header->levsnum - 1].fullsize))
+		throw invalid_argument(string("HbsParser(), the levels are inconsistent with the header: ")
+			.append(filename) += '\n');
+	// Validate the owners: offsets are ordered and each owner is a cluster located
+	// above the owned item, which also excludes the cycles
+	if(m_ownoffs[0] || m_ownoffs[itsnum] != ownsnum)
+		throw invalid_argument(string("HbsParser(), the owners offsets are corrupted: ")
+			.append(filename) += '\n');
+	for(uint64_t i = 0; i < itsnum; ++i) {
+		const uint64_t  ob = m_ownoffs[i];
+		const uint64_t  oe = m_ownoffs[i + 1];
+		if(ob > oe || oe > ownsnum)
+			throw invalid_argument(string("HbsParser(), the owners offsets are corrupted: ")
+				.append(filename) += '\n');
+		for(uint64_t j = ob; j < oe; ++j)
+			if(m_owners[j] <= i || m_owners[j] < ndsnum || m_owners[j] >= itsnum
+			|| (m_shares && !(m_shares[j] >= 0 && m_shares[j] <= 1)))  // Note: NaN is rejected
+				throw invalid_argument(string("HbsParser(), the owners are corrupted: ")
+					.append(filename) += '\n');
+	}
+}
+
+inline void HbsParser::output(FileWrappers& fouts, ClsOutFmtBase clsfmt, bool fltMembers) const
+{
+	using Member = pair<uint32_t, float>;  // Node index and share
+	using Members = vector<Member>;
+
+	const ClsOutFmt  clsoutfmt = toClsOutFmt(clsfmt & ClsOutFmt::MASK_OUTSTRUCT);
+	if(clsoutfmt != ClsOutFmt::ROOT && clsoutfmt != ClsOutFmt::ALLCLS && clsoutfmt != ClsOutFmt::PERLEVEL)
+		throw invalid_argument(string("output(), the output structure is not supported for the snapshot: ")
+			.append(to_string(clsoutfmt)) += '\n');
+	const uint32_t  levsnum = m_header->levsnum;
+	if(fouts.empty() || (clsoutfmt == ClsOutFmt::PERLEVEL ? fouts.size() != levsnum : fouts.size() != 1))
+		throw invalid_argument(string("output(), the number of output files (")
+			.append(std::to_string(fouts.size())).append(") is inconsistent with the output structure\n"));
+#if TRACE >= 1
+	if(isset(clsfmt, ClsOutFmt::MAXSHARE))
+		fputs("WARNING output(), MAXSHARE is not supported for the snapshot and omitted\n", ftrace);
+#endif // TRACE
+	const bool  withhdr = !isset(clsfmt, ClsOutFmt::PURE);
+	const bool  outpnums = withhdr && isset(clsfmt, ClsOutFmt::EXTENDED);
+	const bool  outpshares = outpnums || (withhdr && isset(clsfmt, ClsOutFmt::SHARED));
+	constexpr uint32_t  fltmask = uint32_t(1) << 31;  // Node id filtering mask (the highest bit)
+	const uint64_t  ndsnum = m_header->ndsnum;
+	const uint64_t  clsnum = m_header->clsnum;
+
+	//! The number of owners of the item
+	auto ownsnum = [this](uint64_t i) noexcept -> uint64_t  { return m_ownoffs[i + 1] - m_ownoffs[i]; };
+
+	// Unwrap the clusters in a single pass over the items since the owners are located
+	// above the owned items. Members of the cluster are complete when it is reached.
+	vector<Members>  cmbs(clsnum);  // Members of the clusters
+	for(uint64_t i = 0; i < ndsnum + clsnum; ++i) {
+		if(i >= ndsnum) {
+			// Merge shares of the node reached via multiple owned items
+			auto&  mbs = cmbs[i - ndsnum];
+			if(!mbs.empty()) {
+				std::sort(mbs.begin(), mbs.end(), [](const Member& a, const Member& b) noexcept {
+					return a.first < b.first;
+				});
+				auto  imb = mbs.begin();
+				for(auto jmb = imb + 1; jmb != mbs.end(); ++jmb)
+					if(imb->first == jmb->first)
+						imb->second += jmb->second;
+					else *++imb = *jmb;
+				mbs.erase(++imb, mbs.end());
+			}
+		}
+		for(uint64_t j = m_ownoffs[i]; j < m_ownoffs[i + 1]; ++j) {
+			const float  share = m_shares ? m_shares[j] : 1.f / ownsnum(i);
+			auto&  ombs = cmbs[m_owners[j] - ndsnum];
+			if(i < ndsnum)
+				ombs.emplace_back(i, share);
+			else for(const auto& mb: cmbs[i - ndsnum])
+				ombs.emplace_back(mb.first, mb.second * share);
+		}
+	}
+
+	//! Output the CNL header
+	auto outpHeader = [ndsnum, outpshares, outpnums](FILE* fout, uint64_t num) {
+		fprintf(fout, "# Clusters: %lu,  Nodes: %lu, Fuzzy: %u, Numbered: %u\n"
+			, num, ndsnum, outpshares, outpnums);
+	};
+	//! Output the cluster by its index in the clusters
+	auto outpCluster = [&](FILE* fout, uint64_t icl) {
+		if(outpnums)
+			fprintf(fout, "%u> ", m_ids[ndsnum + icl]);
+		bool  filtered = false;  // The cluster is filtered as nonempty
+		for(const auto& mb: cmbs[icl]) {
+			const uint32_t  nid = m_ids[mb.first];
+			if(fltMembers && nid & fltmask)
+				continue;
+			filtered = true;
+			const auto  nowns = ownsnum(mb.first);
+			if(outpshares && !equalx(Share(mb.second), Share(1) / nowns, nowns))
+				fprintf(fout, "%u:%G ", nid, mb.second);
+			else fprintf(fout, "%u ", nid);
+		}
+		if(filtered)
+			fputc('\n', fout);
+	};
+
+	switch(clsoutfmt) {
+	case ClsOutFmt::ROOT: {
+		uint64_t  num = 0;
+		for(uint64_t icl = 0; icl < clsnum; ++icl)
+			num += !ownsnum(ndsnum + icl);
+		if(withhdr)
+			outpHeader(fouts.front(), num);
+		for(uint64_t icl = 0; icl < clsnum; ++icl)
+			if(!ownsnum(ndsnum + icl))
+				outpCluster(fouts.front(), icl);
+	} break;
+	case ClsOutFmt::ALLCLS:
+		if(withhdr)
+			outpHeader(fouts.front(), clsnum);
+		for(uint64_t icl = 0; icl < clsnum; ++icl)
+			outpCluster(fouts.front(), icl);
+		break;
+	default: {  // PERLEVEL
+		// Each level contains its clusters and the ones propagated from the lower levels,
+		// which are present till the level of their first owner
+		vector<uint32_t>  levs(clsnum);  // Levels of the clusters
+		for(uint32_t ilev = 0, icl = 0; ilev < levsnum; ++ilev)
+			for(uint32_t iend = icl + m_levels[ilev].clsnum; icl < iend; ++icl)
+				levs[icl] = ilev;
+		vector<uint32_t>  pcls;  // Clusters present on the previous level
+		vector<uint32_t>  cls;  // Clusters present on the current level
+		for(uint32_t ilev = 0, icl = 0; ilev < levsnum; ++ilev) {
+			cls.clear();
+			for(auto pcl: pcls)
+				if(!ownsnum(ndsnum + pcl) || levs[m_owners[m_ownoffs[ndsnum + pcl]] - ndsnum] > ilev)
+					cls.push_back(pcl);
+			for(uint32_t iend = icl + m_levels[ilev].clsnum; icl < iend; ++icl)
+				cls.push_back(icl);
+			if(withhdr)
+				outpHeader(fouts[ilev], cls.size());
+			for(auto cl: cls)
+				outpCluster(fouts[ilev], cl);
+			pcls.swap(cls);
+		}
+	}
+	}
+}
+
+}  // daoc
+
+#endif // PARSER_HBS_HPP
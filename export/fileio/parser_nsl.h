@@ -35,6 +35,18 @@ public:
     //! \return bool - input network is weighted
 	bool weighted() const  { return m_weighted; }
 
+    //! \brief Whether each edge is listed in both directions, see InpOptions::mirrored
+    //!
+    //! \return bool  - the mirrored edges are skipped on building
+	bool mirrored() const  { return m_mirrored; }
+
+    //! \brief Specify whether each edge is listed in both directions
+    //! \note Applied by build(), InpOptions::mirrored is not considered by the constructor
+    //!
+    //! \param mirrored bool  - skip the mirrored edges (src id > dst id) on building
+    //! \return void
+	void mirrored(bool mirrored)  { m_mirrored = mirrored; }
+
     //! \brief Build the input graph from the underlying file of the input network
     //!
     //! \return shared_ptr<GraphT>  - resulting input graph
@@ -62,6 +74,8 @@ private:
 	string  m_line;  //! Parsed line (required to hold the line after the header to start the build() with it)
 	const bool  m_shuffle;  //!< Shuffle links and nodes on construction
 	const bool  m_sumdups;  //!< Accumulate weight of duplicated links or just skip them
+	//! Each edge is listed in both directions, skip the mirrored edges (InpOptions::mirrored)
+	bool  m_mirrored = false;
 	bool  m_weighted;  //!< Whether the input network is weighted
 	bool  m_directed;  //!< Whether the input network is directed (arcs) or underected (only edges)
 	Id  m_nodes;  //!< The number of nodes in the network, 0 if unknown
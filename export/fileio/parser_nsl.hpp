@@ -14,6 +14,7 @@
 #define PARSER_NSL_HPP
 
 #include <stdexcept>
+#include "operations.hpp"  // radixSort
 #include "fileio/rawparse.hpp"
 #include "fileio/parser_nsl.h"
 
@@ -71,12 +72,52 @@ shared_ptr<GraphT> NslParser::build()
 			|| !strchr(m_spaces, end);  // Note: ending '\0 ' is considered by the strchr
 	};
 
+	// Note: the edges are buffered in blocks and grouped by the src ids to add
+	// all links of the src node in a single batch even if the input is not
+	// ordered by the src ids. Otherwise each change of the src id yields a
+	// separate addition of the node and links.
+	//! Buffered input edge (arc)
+	struct SrcLink {
+		Id  sid;  //!< Src node id
+		Id  did;  //!< Dest node id
+		Weight  weight;  //!< Link weight, 0 if not specified
+	};
+	// The number of buffered edges, ~12-16 MB
+	constexpr size_t  EDGES_BLOCK = 1 << 20;
+	vector<SrcLink>  edges;  // Buffered edges
+	vector<SrcLink>  ebuf;  // Buffer for the edges grouping
+	edges.reserve(EDGES_BLOCK);
+	bool  grouped = true;  // The buffered edges are ordered by the src ids
 	typename GraphT::InpLinksT  links;
-	Id  nodeId = ID_NONE;  // Current node id
-#if VALIDATE >= 1
 	Size  linksSize = 0;  // The number of links
-#endif // VALIDATE
-	StructLinkErrors  lnerrs("WARNING build(), the duplicated links are skipped: ");
+	// Note: the mirrored edges are skipped only for the undirected input, where
+	// each back link is added together with the direct link
+	const bool  mirrored = m_mirrored && !m_directed;
+#if TRACE >= 1
+	if(m_mirrored && m_directed)
+		fputs("WARNING build(), the mirrored listing is applicable only for the edges"
+			", the arcs are loaded as is\n", ftrace);
+#endif // TRACE
+	// Note: the duplicated links are only counted retaining a bounded sample
+	// to keep the memory flat
+	CountedErrors<StructLinkErrors>  lnerrs("WARNING build(), the duplicated links are skipped: ");
+
+	// Add the buffered edges to the graph grouping them by the src ids
+	auto addEdges = [&]() {
+		if(!grouped)
+			radixSort(edges, ebuf, [](const SrcLink& ln) noexcept { return ln.sid; });
+		for(auto ie = edges.begin(); ie != edges.end();) {
+			const Id  sid = ie->sid;
+			do addLink(links, ie->did, ie->weight);
+			while(++ie != edges.end() && ie->sid == sid);
+			if(m_directed)
+				graph.template addNodeAndLinks<true>(sid, move(links), &lnerrs);
+			else graph.template addNodeAndLinks<false>(sid, move(links), &lnerrs);
+			links.clear();
+		}
+		edges.clear();
+		grouped = true;
+	};
 	errno = 0;
 	do {
 		char* str = const_cast<char*>(m_line.c_str());
@@ -89,34 +130,31 @@ shared_ptr<GraphT> NslParser::build()
 		if(!skipSymbols(str, m_spaces))  // End of str
 			throw domain_error(m_line.insert(0, "ERROR build(), The dest id is expected: ") += '\n');  // Note: m_line doesn't have ending "\n"
 		auto did = parseVal<Id>(str, strtoul, invalId, invalIdMsg);
+		++linksSize;
+		// Skip the mirrored edge in O(1), its counterpart with the lower src id
+		// yields both links
+		if(mirrored && sid > did)
+			continue;
 
-		// Add links accumulated for the node to the graph
-		if(sid != nodeId && !links.empty()) {
-			if(m_directed)
-				graph.template addNodeAndLinks<true>(nodeId, move(links), &lnerrs);
-			else graph.template addNodeAndLinks<false>(nodeId, move(links), &lnerrs);
-			links.clear();
-		}
-		nodeId = sid;
+		// Add the buffered edges to the graph
+		if(edges.size() == EDGES_BLOCK)
+			addEdges();
+		grouped = grouped && (edges.empty() || edges.back().sid <= sid);
 
 		// Set the weight only if it explicitly specified for the weighted network
-		if(GraphT::InpLinkT::IS_WEIGHTED && skipSymbols(str, m_spaces))
-			//links.emplace_back(did, parseVal<Weight>(str, strtof));
-			addLink(links, did, parseVal<Weight>(str, strtof));
-		else links.emplace_back(did);
-#if VALIDATE >= 1
-		++linksSize;
-#endif // VALIDATE
+		edges.push_back({sid, did, GraphT::InpLinkT::IS_WEIGHTED && skipSymbols(str, m_spaces)
+			? parseVal<Weight>(str, strtof) : 0});
 	} while(getline(m_infile, m_line));
 
-	// Add remained links
-	if(!links.empty()) {
-		if(m_directed)
-			graph.template addNodeAndLinks<true>(nodeId, move(links), &lnerrs);
-		else graph.template addNodeAndLinks<false>(nodeId, move(links), &lnerrs);
-	}
+	// Add remained edges
+	addEdges();
 #if TRACE >= 1
 	lnerrs.show();
+	// Note: each mirrored edge yields two duplicated links (in both directions)
+	if(!m_directed && !mirrored && linksSize && lnerrs.num() * 10 >= linksSize * 9)
+		fprintf(ftrace, "WARNING build(), %lu duplicated links of %lu edges, the edges seem"
+			" to be listed in both directions. The mirrored listing (-nem) can be specified"
+			" to skip them on loading\n", lnerrs.num(), linksSize);
 #if VALIDATE >= 1
 	if(m_links && m_links != linksSize)
 		fprintf(ftrace, "The number of links specified in the header (%lu) does not"
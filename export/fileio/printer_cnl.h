@@ -14,6 +14,7 @@
 #define PRINTER_CNL_H
 
 #include "fileio/iotypes.h"
+#include "fileio/printer_npy.h"  // NodeVecBinWriter
 
 namespace daoc {
 
@@ -58,14 +59,78 @@ public:
     //! 	only the bottom level.
     //! 	Note: applicable only for the ClsOutFmt::CUSTLEVS
     //! \param signif=nullptr const SignifclsOptions*  - options for the significant clusters output
+    //! \param fvecbin=nullptr NodeVecBinWriter*  - binary (.npy) nodes vectorization output,
+    //! 	which is written along with the textual fvec (if any)
     //! \return void
 	void output(FileWrapper& fvec, const NodeVecCoreOptions& nvo, FileWrappers& fouts
 		, ClsOutFmtBase clsfmt, bool fltMembers=false, LevelNum blev=0, LevelNum elev=LEVEL_NONE
 		, const float levStepRatio=1, const SignifclsOptions* signif=nullptr
+		, NodeVecBinWriter* fvecbin=nullptr
 #if	VALIDATE >= 2
 		, const vector<LevelNum>& ilevs={}
 #endif // VALIDATE
 		);
+
+    //! \brief Output the specified levels to the single indexed archive
+    //! \note The archive is written in one sequential pass over the hierarchy levels
+    //! 	without any seeking, so the output can be a pipe. The archive consists of:
+    //! 	- the archive header: "# CNL Archive: Levels: <levsnum>, Nodes: <ndsnum>, Fuzzy: <f>, Numbered: <n>";
+    //! 	- level blocks, each is a valid CNL content (with its own header unless PURE)
+    //! 		till the following level block or the level index;
+    //! 	- the level index trailer, one line per level: "# Level <levid>: Clusters: <clsnum>, Offset: <offset>",
+    //! 		where offset is the position of the level block from the archive beginning,
+    //! 		finalized by the "# Index: Levels: <levsnum>, Offset: <offset>" line locating the index.
+    //!
+    //! \param fout FileWrapper&  - output file
+    //! \param clsfmt ClsOutFmtBase  - cluster output format, the output structure is ignored
+    //! \param fltMembers=false bool  - use the highest bit of the node id as a filtering out
+    //! 	flag from the clustering results
+    //! \param ilevs={} const vector<LevelNum>&  - indexes of the outputting levels from the
+    //! 	bottom in the ascending order, all levels are outputted if empty
+    //! \return void
+	void archive(FileWrapper& fout, ClsOutFmtBase clsfmt, bool fltMembers=false
+		, const vector<LevelNum>& ilevs={}) const;
+
+    //! \brief Output the clusters membership in the binary format (.cnb)
+    //! \note See CnbHeader for the format, the output is loaded by CnbParser
+    //!
+    //! \param fout FileWrapper&  - output file opened in the binary mode
+    //! \param clsfmt ClsOutFmtBase  - cluster output format, ROOT, ALLCLS and PERLEVEL
+    //! 	(the single ilev level) output structures are supported. The shares are stored
+    //! 	for the SHARED and EXTENDED formats, the cluster ids for the EXTENDED format.
+    //! \param fltMembers=false bool  - use the highest bit of the node id as a filtering out
+    //! 	flag from the clustering results
+    //! \param ilev=0 LevelNum  - index of the outputting level from the bottom for PERLEVEL
+    //! \return void
+	void binary(FileWrapper& fout, ClsOutFmtBase clsfmt, bool fltMembers=false
+		, LevelNum ilev=0) const;
+
+    //! \brief Output quality metrics of the clusters: size, internal and cut
+    //! 	weights, density and conductance
+    //! \note The metrics are evaluated in parallel. The columnar binary format
+    //! 	(see CmbHeader) or CSV with the header line is produced.
+    //!
+    //! \param fout FileWrapper&  - output file, opened in the binary mode for the binary output
+    //! \param clsfmt ClsOutFmtBase  - cluster output format: ROOT, ALLCLS (the unique clusters
+    //! 	without the node wrappers) and PERLEVEL (each level including the propagated clusters)
+    //! 	output structures are supported
+    //! \param binary=false bool  - output in the Cluster Metrics Binary format instead of CSV
+    //! \param workers=0 unsigned  - the number of workers, 0 means the number of the hardware threads
+    //! \return void
+	void metrics(FileWrapper& fout, ClsOutFmtBase clsfmt, bool binary=false
+		, unsigned workers=0) const;
+protected:
+    //! \brief Output cluster to the specified file
+    //!
+    //! \param cl const Cluster<LinksT>&  - the cluster to be outputted
+    //! \param cnodes const ClusterNodes<LinksT>&  - member nodes with shares
+    //! \param fout FILE*  - output file
+    //! \param outpnums bool  - prefix the cluster with its id
+    //! \param outpshares bool  - output unequal shares of the fuzzy overlaps
+    //! \param fltMembers bool  - filter out nodes having the highest bit of the id set
+    //! \return size_t  - the number of written bytes
+	static size_t outpCluster(const Cluster<LinksT>& cl, const ClusterNodes<LinksT>& cnodes
+		, FILE* fout, bool outpnums, bool outpshares, bool fltMembers) noexcept;
 };
 
 // Accessory functions ---------------------------------------------------------
@@ -16,8 +16,13 @@
 
 #include <cstdio>
 #include <stdexcept>  // Exception (for Arguments processing)
+#include <cstring>  // memcpy
+#include <algorithm>  // remove_if
 
 #include "types.h"
+#include "parallel.hpp"  // parallelRanges, workersNum
+#include "flathash.hpp"  // FlatHashMap
+#include "fileio/printer_npy.hpp"
 #include "fileio/printer_cnl.h"
 
 
@@ -26,6 +31,7 @@ namespace daoc {
 using std::advance;
 using std::invalid_argument;
 using std::logic_error;
+using std::remove_if;
 
 
 // CNL Printer ----------------------------------------------------------------
@@ -33,6 +39,7 @@ template <typename LinksT>
 void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 	, FileWrappers& fouts, ClsOutFmtBase clsfmt, bool fltMembers, LevelNum blev
 	, LevelNum elev, const float levStepRatio, const SignifclsOptions* signif
+	, NodeVecBinWriter* fvecbin
 #if	VALIDATE >= 2
 	, const vector<LevelNum>& ilevs
 #endif // VALIDATE
@@ -49,7 +56,7 @@ void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 #if TRACE >= 2
 	fprintf(ftrace, " > output(), Starting hierarchy output in the CNL format: %s\n"
 		, strClsOutFmt(clsfmt).c_str());
-	if(fvec)
+	if(fvec || fvecbin)
 		fprintf(ftrace, " > output(), Starting node vectorization:  dclnds: %u, valfmt: %s, compr: %s"
 			", numbered: %u, wdimrank: %u, brief: %u, valmin: %G\n", nvo.dclnds, to_string(nvo.value).c_str()
 			, to_string(nvo.compr).c_str(), nvo.numbered, nvo.wdimrank, nvo.brief, nvo.valmin);
@@ -60,7 +67,6 @@ void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 	const bool outpnums = isset(clsfmt, ClsOutFmt::EXTENDED);  // Numbered output (prefix with cluster ids)
 	const bool outpshares = outpnums || isset(clsfmt, ClsOutFmt::SHARED);  // Output unequal shares (fuzzy overlaps)
 	const Id ndsnum = m_hier.nodes().size();
-	const Id fltmask = 1 << sizeof(Id) * 8 - 1;  // Node id filtering mask (the highest bit)
 	const LevelNum  levsnum = m_hier.levels().size();
 	// Node Vectorization constants
 	using DimWeight = LinkWeight;  // Node projection value (weight)
@@ -82,6 +88,12 @@ void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 	const string comprstr = to_string(nvo.compr);
 	const auto valmin = nvo.valmin;
 	const bool numbvec = nvo.numbered;
+	const bool vecbin = fvecbin && *fvecbin;  // Binary node vectorization output
+	const bool vecout = fvec || vecbin;  // Node vectorization output
+	//! Column indexes of the nodes in the binary vectorization
+	// Note: nodes are stored in a list, so the index can't be fetched by the node address
+	using NodeColumns = FlatHashMap<const Node<LinksT>*, Id>;
+	NodeColumns  ndcols;
 
 	// CRUCIAL Concept: Significance of the clusters in the hierarchy for the similarity of nodes
 	// can be defined based on the hierarchy level ~= clusters size in nodes.
@@ -165,16 +177,24 @@ void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 	//! \brief Output node projection value
 	//! \pre wproj >= valmin
 	//!
-	//! \param nid Id  - the node id
+	//! \param nd const Node<LinksT>&  - the node
 	//! \param wproj DimWeight  - node
 	//! \return bool  - the node is outputted or omitted
-	auto outpNodeProj = [&fvec, valfmt, valmin](Id nid, DimWeight wproj) noexcept -> bool {
+	auto outpNodeProj = [&fvec, fvecbin, vecbin, &ndcols, valfmt, valmin](const Node<LinksT>& nd
+	, DimWeight wproj) -> bool {
+		const Id  nid = nd.id;
 #if VALIDATE >= 2
 		assert(wproj > 0 && !less<DimWeight>(wproj, valmin)
 			&& "outpNodeVecVal(), node projection should be positive");
 #endif // VALIDATE
 		//if(!less<DimWeight>(wproj, valmin))
 		//	return;
+		// Note: the binary output is written directly, without any intermediate textual form
+		if(vecbin) {
+			const bool  res = fvecbin->add(ndcols.at(&nd), wproj);
+			if(!fvec || !res)
+				return res;
+		}
 		switch(valfmt) {
 		case NodeVecFmtVal::BIT:
 			if(!less<DimWeight>(wproj, 0.5)) {
@@ -185,8 +205,7 @@ void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 		case NodeVecFmtVal::UINT8: {
 			using VType = uint8_t;
 			constexpr auto  vmax = numeric_limits<VType>::max();
-			const DimWeight  corr = max<DimWeight>(valmin - 0.5f / vmax, 0);
-			const VType  v = round((wproj - corr) / (1 - corr) * vmax);
+			const VType  v = quantNodeProj<VType>(wproj, valmin);
 			if(v) {
 				fprintf(fvec, "%u:%u ", nid, vmax - v + 1);  // Required to recover val as 1./venc
 				return true;
@@ -195,8 +214,7 @@ void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 		case NodeVecFmtVal::UINT16: {
 			using VType = uint16_t;
 			constexpr auto  vmax = numeric_limits<VType>::max();
-			const DimWeight  corr = max<DimWeight>(valmin - 0.5f / vmax, 0);
-			const VType  v = round((wproj - corr) / (1 - corr) * vmax);
+			const VType  v = quantNodeProj<VType>(wproj, valmin);
 			if(v) {
 				fprintf(fvec, "%u:%u ", nid, vmax - v + 1);  // Required to recover val as 1./venc
 				return true;
@@ -254,29 +272,9 @@ void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 	//! \param cnodes const ClusterNodes<LinksT>&  - member nodes with shares
 	//! \param fout FileWrapper&  - output file
 	//! \return void
-	auto outpCluster = [outpnums, outpshares, fltMembers, fltmask](const Cluster<LinksT>& cl
+	auto outpCluster = [outpnums, outpshares, fltMembers](const Cluster<LinksT>& cl
 	, const ClusterNodes<LinksT>& cnodes, FILE* fout=stdout) noexcept {
-		// Cluster id
-		if(outpnums)
-			fprintf(fout, "%u> ", cl.id);
-		// Node shares
-		bool filtered = false;  // The cluster is filtered as nonempty
-		for(const auto& icn: cnodes) {  // first = dest, second = share
-			// Filter out marked nodes if required
-			if(fltMembers && icn.first->id & fltmask)
-				continue;
-			filtered = true;
-			if(outpshares
-			// Save share of all overlaps (0 <= share < 1)
-			//&& less(icn.second, Share(1))
-			// Save only unequal shares of the overlaps (fuzzy overlaps)
-			&& !equalx(icn.second, Share(1) / icn.first->owners.size()
-			, icn.first->owners.size()))  // Note: the number of owners is small
-				fprintf(fout, "%u:%G ", icn.first->id, icn.second);
-			else fprintf(fout, "%u ", icn.first->id);
-		}
-		if(filtered)
-			fputc('\n', fout);
+		CnlPrinter::outpCluster(cl, cnodes, fout, outpnums, outpshares, fltMembers);
 	};
 
 //	//! \brief Output cluster to the specified file
@@ -500,7 +498,7 @@ void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 			: dens(dens), weight(weight), reqs(0)  {}
 		};
 		//! Clusters constraints
-		using ClusterCsts = unordered_map<const Cluster<LinksT>*, OwnerConstraints, SolidHash<const Cluster<LinksT>*>>;
+		using ClusterCsts = FlatHashMap<const Cluster<LinksT>*, OwnerConstraints>;
 		// Cluster density
 		// Preallocate taking second level from the bottom if exists, otherwise root.
 		// Second level is taken because we are interested in the owners of the widest
@@ -640,14 +638,21 @@ void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 
 		// Node Vectorization related variables
 		//! Clusters owner rank (max number of owners till the root level)
-		using ClusterRanks = unordered_map<Id, LevelNum>;
+		using ClusterRanks = FlatHashMap<Id, LevelNum>;
 		const bool  wdimranked = nvo.wdimrank;  // Weight dimensions by the cluster owners rank or by the cluster weight
 		size_t  dimspos = 0;  // Position of the dimensions number in the header
 		if(fvec)
 			dimspos = outpVecHeader(m_hier.root().size());
+		if(vecbin) {
+			fvecbin->columns(m_hier.nodes());
+			ndcols.reserve(ndsnum);
+			Id  icol = 0;
+			for(const auto& nd: m_hier.nodes())
+				ndcols.emplace(&nd, icol++);
+		}
 		ClusterRanks  cranks;  // Cluster ranks, required to evaluate the local rank for each representative cluster
 		DimInfos  dinfos;  // Dimension (cluster) information
-		if(fvec && !nvo.brief) {
+		if(vecout && !nvo.brief) {
 			dinfos.reserve(sqrtf(m_hier.nodes().size()) / 2);
 			if(wdimranked)
 				cranks.reserve(m_hier.score().clusters - m_hier.levels().back().clusters.size());
@@ -666,7 +671,7 @@ void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 		for(auto ilev = m_hier.levels().rbegin(); ilev != erlev; ++ilev, ++levind) {
 			for(auto& cl: ilev->clusters) {
 				LevelNum  orank = 0;  //!< Owners rank (the longest number of owners till the root), <= levsnum
-				if(fvec && wdimranked && !nvo.brief) {
+				if(vecout && wdimranked && !nvo.brief) {
 					for(auto& ocl: cl.owners)
 						if(orank < cranks.at(ocl.dest->id))
 							orank = cranks[ocl.dest->id];
@@ -687,7 +692,7 @@ void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 					if(cnodes.size() >= signif->szmin || cl.owners.empty()) {
 						outpCluster(cl, cnodes, fouts.front());
 						++clsnum;
-						if(fvec && dimsnum < dimsmax) {
+						if(vecout && dimsnum < dimsmax) {
 							bool  outpdim = false;  // The dimension contains significant node projections and will be outputted
 							// The expected number of linked external nodes is:
 							// |c| * d * (1 - |c| / N) / d * (1 - Q_c),
@@ -744,10 +749,10 @@ void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 #endif // TRACE
 								if(!less<DimWeight>(wproj, valmin)) {
 									// Output dimension (cluster) id if required
-									if(numbvec && !outpdim)
+									if(fvec && numbvec && !outpdim)
 										fprintf(fvec, "%u> ", cl.id);
 									// Note: outpdim should be set to true also for !numbvec
-									outpdim |= outpNodeProj(nd.id, wproj);
+									outpdim |= outpNodeProj(nd, wproj);
 								}
 							}
 							// Add accumulated external projections
@@ -758,11 +763,14 @@ void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 							for(const auto& lnd: lnds) {
 								const DimWeight  weight = lnd.second / (lnd.first->ctxWeight() + wcorr);
 								if(!less<DimWeight>(weight, valmin))
-									outpdim |= outpNodeProj(lnd.first->id, weight);
+									outpdim |= outpNodeProj(*lnd.first, weight);
 							}
 							lnds.clear();
 							if(outpdim) {
-								fputc('\n', fvec);
+								if(fvec)
+									fputc('\n', fvec);
+								if(vecbin)
+									fvecbin->commit();
 								++dimsnum;
 								// Add cluster to the vector to identify its index;
 								// Note: levels are enumerated from 1, so num - rindex corresponds to the correct levid
@@ -780,8 +788,8 @@ void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 											, wsim, wdis*wdis, cl.owners.empty()});
 									}
 								}
-							}
-
+							} else if(vecbin)
+								fvecbin->discard();
 						}
 					}
 #if TRACE >= 2
@@ -806,14 +814,21 @@ void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 #if TRACE >= 2
 		fprintf(ftrace, "\n> output(), %u significant cls filtered out from the output\n", szfltcs);
 #endif // TRACE
-		if(fvec) {
+		if(vecout) {
 #if VALIDATE >= 2
 			assert(dinfos.size() == dimsnum && "output(), validation of the number of dimensions failed");
 #endif // VALIDATE
-			if(!nvo.brief)
-				outpVecFooter(dinfos);
+			if(!nvo.brief) {
+				if(fvec)
+					outpVecFooter(dinfos);
+				if(vecbin)
+					fvecbin->diminfos(dinfos);
+			}
+			if(vecbin)
+				fvecbin->close();
 			// Fill the dimensions number placeholder
-			if(dimspos) {
+			// Note: the placeholder is retained for the non-seekable (compressed) output
+			if(dimspos && dimspos != static_cast<decltype(dimspos)>(-1)) {
 				fseek(fvec, dimspos, SEEK_SET);
 				fprintf(fvec, "%u,", dimsnum);
 				fseek(fvec, 0, SEEK_END);
@@ -838,6 +853,345 @@ void CnlPrinter<LinksT>::output(FileWrapper& fvec, const NodeVecCoreOptions& nvo
 #endif // TRACE
 }
 
+template <typename LinksT>
+void CnlPrinter<LinksT>::archive(FileWrapper& fout, ClsOutFmtBase clsfmt, bool fltMembers
+	, const vector<LevelNum>& ilevs) const
+{
+	const LevelNum  levsnum = m_hier.levels().size();
+	if(!fout || !levsnum) {
+#if TRACE >= 2
+		fprintf(ftrace, " > WARNING archive(), levels output is sipped;  fout: %d"
+			", hier levels: %u\n", bool(fout), levsnum);
+#endif // TRACE
+		return;
+	}
+#if TRACE >= 2
+	fprintf(ftrace, " > archive(), Starting hierarchy levels output to the CNL archive: %s\n"
+		, strClsOutFmt(clsfmt).c_str());
+#endif // TRACE
+	// Validate the target levels
+	for(auto ilev = ilevs.begin(); ilev != ilevs.end(); ++ilev)
+		if(*ilev >= levsnum || (ilev != ilevs.begin() && *ilev <= *(ilev - 1)))
+			throw invalid_argument(string("archive(), ilevs should be ascending and less than ")
+				.append(std::to_string(levsnum)).append(", invalid: ")
+				.append(std::to_string(*ilev)) += '\n');
+
+	const bool  withhdr = !isset(clsfmt, ClsOutFmt::PURE);  // Whether to output cnl header of the levels
+	if(!withhdr)
+		clsfmt = *ClsOutFmt::SIMPLE;  // The same as in output(), these formats differ only by the header
+	const bool  outpnums = isset(clsfmt, ClsOutFmt::EXTENDED);  // Numbered output (prefix with cluster ids)
+	const bool  outpshares = outpnums || isset(clsfmt, ClsOutFmt::SHARED);  // Output unequal shares (fuzzy overlaps)
+	const bool  maxshare = isset(clsfmt, ClsOutFmt::MAXSHARE);  // Max share only from the overlapping node is required
+	const Id  ndsnum = m_hier.nodes().size();
+	const LevelNum  outlevs = ilevs.empty() ? levsnum : ilevs.size();  // The number of outputting levels
+
+	// Archive header, the level index is written as a trailer to keep the output sequential
+	int  wbytes = fprintf(fout, "# CNL Archive: Levels: %u, Nodes: %u, Fuzzy: %u, Numbered: %u\n"
+		, outlevs, ndsnum, outpshares, outpnums);
+	if(wbytes < 0)
+		throw std::ios_base::failure("ERROR archive(), the archive header output failed\n");
+	size_t  offset = wbytes;  // Offset from the archive beginning, counted without the seeking
+
+	// Output the levels in a single pass from the bottom tracing the propagated clusters
+	using ClusterPtrs = vector<const Cluster<LinksT>*>;
+	ClusterPtrs  actcls;  // Active clusters of the processing level including the propagated ones
+	actcls.reserve(m_hier.levels().front().fullsize);
+	struct LevelBlock {
+		LevelNum  levi;  // Index of the level from the bottom
+		Id  clsnum;  // The number of clusters on the level
+		size_t  offset;  // Offset of the level block from the archive beginning
+	};
+	vector<LevelBlock>  blocks;  // Index of the outputted levels
+	blocks.reserve(outlevs);
+	auto  itarg = ilevs.begin();
+	LevelNum  levi = 0;
+	for(const auto& lev: m_hier.levels()) {
+		if(!ilevs.empty() && itarg == ilevs.end())
+			break;
+		// Drop the clusters having owners on the current level, add the level clusters
+		actcls.erase(remove_if(actcls.begin(), actcls.end(), [levi](const Cluster<LinksT>* cl) noexcept {
+			return !cl->owners.empty() && cl->owners.front().dest->levnum <= levi;
+		}), actcls.end());
+		for(const auto& cl: lev.clusters)
+			actcls.push_back(&cl);
+		if(ilevs.empty() || *itarg == levi) {
+			blocks.push_back({levi, static_cast<Id>(lev.fullsize), offset});
+			if(withhdr) {
+				wbytes = fprintf(fout, "# Clusters: %u,  Nodes: %u, Fuzzy: %u, Numbered: %u\n"
+					, static_cast<Id>(lev.fullsize), ndsnum, outpshares, outpnums);
+				if(wbytes > 0)
+					offset += wbytes;
+			}
+			for(auto cl: actcls)
+				offset += outpCluster(*cl, m_hier.unwrap(*cl, maxshare), fout, outpnums, outpshares, fltMembers);
+			if(ferror(fout))
+				throw std::ios_base::failure(string("ERROR archive(), the output of level ")
+					.append(std::to_string(levi)).append(" failed\n"));
+			if(!ilevs.empty())
+				++itarg;
+		}
+		++levi;
+	}
+#if VALIDATE >= 2
+	assert(blocks.size() == outlevs && "archive(), level blocks are not synced with the index");
+#endif // VALIDATE
+
+	// Level index trailer, its last line locates the index
+	const size_t  idxoff = offset;
+	for(const auto& blk: blocks)
+		fprintf(fout, "# Level %u: Clusters: %u, Offset: %lu\n", blk.levi, blk.clsnum, blk.offset);
+	fprintf(fout, "# Index: Levels: %u, Offset: %lu\n", outlevs, idxoff);
+	if(ferror(fout))
+		throw std::ios_base::failure("ERROR archive(), the level index output failed\n");
+#if TRACE >= 2
+	fprintf(ftrace, " > archive(), Hierarchy levels output to the CNL archive completed\n");
+#endif // TRACE
+}
+
+template <typename LinksT>
+void CnlPrinter<LinksT>::binary(FileWrapper& fout, ClsOutFmtBase clsfmt, bool fltMembers
+	, LevelNum ilev) const
+{
+#if TRACE >= 2
+	fprintf(ftrace, " > binary(), Starting clusters output in the CNB format: %s\n"
+		, strClsOutFmt(clsfmt).c_str());
+#endif // TRACE
+	const bool  outpnums = isset(clsfmt, ClsOutFmt::EXTENDED);  // Store cluster ids
+	const bool  outpshares = outpnums || isset(clsfmt, ClsOutFmt::SHARED);  // Store member shares
+	const bool  maxshare = isset(clsfmt, ClsOutFmt::MAXSHARE);  // Max share only from the overlapping node is required
+	constexpr Id  fltmask = Id(1) << (sizeof(Id) * 8 - 1);  // Node id filtering mask (the highest bit)
+
+	// Fetch the outputting clusters
+	vector<const Cluster<LinksT>*>  cls;
+	const ClsOutFmt  clsoutfmt = toClsOutFmt(clsfmt & ClsOutFmt::MASK_OUTSTRUCT);
+	switch(clsoutfmt) {
+	case ClsOutFmt::ROOT:
+		cls.assign(m_hier.root().begin(), m_hier.root().end());
+		break;
+	case ClsOutFmt::ALLCLS:
+		// Skip the node wrappers and propagated clusters (except the root level) as output() does
+		for(const auto& lev: m_hier.levels())
+			for(const auto& cl: lev.clusters)
+				if(cl.des.size() >= 2 || cl.des.front()->owners.size() >= 2 || cl.owners.empty())
+					cls.push_back(&cl);
+		break;
+	case ClsOutFmt::PERLEVEL: {
+		if(ilev >= m_hier.levels().size())
+			throw invalid_argument(string("binary(), ilev is out of range: ")
+				.append(std::to_string(ilev)) += '\n');
+		// Clusters of the level including the propagated ones
+		LevelNum  levi = 0;
+		for(const auto& lev: m_hier.levels()) {
+			for(const auto& cl: lev.clusters)
+				if(cl.owners.empty() || cl.owners.front().dest->levnum > ilev)
+					cls.push_back(&cl);
+			if(levi++ == ilev)
+				break;
+		}
+	} break;
+	default:
+		throw invalid_argument(string("binary(), unsupported ClsOutFmt: ")
+			.append(to_string(clsoutfmt, true)) += '\n');
+	}
+
+	// Form the sections
+	vector<uint32_t>  cids;
+	vector<uint64_t>  offsets;
+	vector<uint32_t>  members;
+	vector<float>  shares;
+	if(outpnums)
+		cids.reserve(cls.size());
+	offsets.reserve(cls.size() + 1);
+	offsets.push_back(0);
+	for(auto cl: cls) {
+		for(const auto& icn: m_hier.unwrap(*cl, maxshare)) {  // first = dest, second = share
+			if(fltMembers && icn.first->id & fltmask)
+				continue;
+			members.push_back(icn.first->id);
+			if(outpshares)
+				shares.push_back(equalx(icn.second, Share(1) / icn.first->owners.size()
+					, icn.first->owners.size()) ? 0 : icn.second);
+		}
+		// Skip the filtered out clusters
+		if(members.size() == offsets.back())
+			continue;
+		offsets.push_back(members.size());
+		if(outpnums)
+			cids.push_back(cl->id);
+	}
+
+	CnbHeader  hdr;
+	memcpy(hdr.signature, CNB_SIGNATURE, sizeof hdr.signature);
+	hdr.version = CnbHeader::VERSION;
+	hdr.flags = CNB_NONE;
+	if(outpnums)
+		hdr.flags |= CNB_NUMBERED;
+	if(outpshares)
+		hdr.flags |= CNB_SHARES;
+	hdr.clsnum = offsets.size() - 1;
+	hdr.ndsnum = m_hier.nodes().size();
+	hdr.mbsnum = members.size();
+
+	//! Write the section padded to the 8 bytes alignment
+	auto put = [&fout](const void* data, size_t size) {
+		constexpr uint64_t  zero = 0;
+		if(fwrite(data, 1, size, fout) != size
+		|| (size != binAligned(size) && fwrite(&zero, 1, binAligned(size) - size, fout)
+			!= binAligned(size) - size))
+			throw std::ios_base::failure("ERROR binary(), CNB writing failed\n");
+	};
+	put(&hdr, sizeof hdr);
+	put(cids.data(), cids.size() * sizeof(uint32_t));
+	put(offsets.data(), offsets.size() * sizeof(uint64_t));
+	put(members.data(), members.size() * sizeof(uint32_t));
+	put(shares.data(), shares.size() * sizeof(float));
+#if TRACE >= 2
+	fprintf(ftrace, " > binary(), %lu clusters having %lu members outputted in the CNB format\n"
+		, hdr.clsnum, hdr.mbsnum);
+#endif // TRACE
+}
+
+template <typename LinksT>
+void CnlPrinter<LinksT>::metrics(FileWrapper& fout, ClsOutFmtBase clsfmt, bool binary
+	, unsigned workers) const
+{
+#if TRACE >= 2
+	fprintf(ftrace, " > metrics(), Starting clusters metrics output: %s\n"
+		, strClsOutFmt(clsfmt).c_str());
+#endif // TRACE
+	// Fetch the evaluating clusters with their levels
+	vector<const Cluster<LinksT>*>  cls;
+	vector<uint32_t>  levs;
+	const ClsOutFmt  clsoutfmt = toClsOutFmt(clsfmt & ClsOutFmt::MASK_OUTSTRUCT);
+	switch(clsoutfmt) {
+	case ClsOutFmt::ROOT:
+		cls.assign(m_hier.root().begin(), m_hier.root().end());
+		for(auto cl: cls)
+			levs.push_back(cl->levnum);
+		break;
+	case ClsOutFmt::ALLCLS:
+		// Skip the node wrappers and propagated clusters (except the root level) as output() does
+		for(const auto& lev: m_hier.levels())
+			for(const auto& cl: lev.clusters)
+				if(cl.des.size() >= 2 || cl.des.front()->owners.size() >= 2 || cl.owners.empty()) {
+					cls.push_back(&cl);
+					levs.push_back(cl.levnum);
+				}
+		break;
+	case ClsOutFmt::PERLEVEL: {
+		// Clusters of each level including the propagated ones, which are carried over
+		// the levels in a single pass from the bottom the same as in archive()
+		vector<const Cluster<LinksT>*>  actcls;  // Active clusters of the processing level
+		LevelNum  levi = 0;
+		for(const auto& lev: m_hier.levels()) {
+			// Drop the clusters having owners on the current level, add the level clusters
+			actcls.erase(remove_if(actcls.begin(), actcls.end(), [levi](const Cluster<LinksT>* cl) noexcept {
+				return !cl->owners.empty() && cl->owners.front().dest->levnum <= levi;
+			}), actcls.end());
+			for(const auto& cl: lev.clusters)
+				actcls.push_back(&cl);
+			cls.insert(cls.end(), actcls.begin(), actcls.end());
+			levs.insert(levs.end(), actcls.size(), levi++);
+		}
+	} break;
+	default:
+		throw invalid_argument(string("metrics(), unsupported ClsOutFmt: ")
+			.append(to_string(clsoutfmt, true)) += '\n');
+	}
+
+	// Evaluate the metrics columns
+	const size_t  clsnum = cls.size();
+	vector<uint32_t>  ids(clsnum);
+	vector<double>  sizes(clsnum);
+	vector<double>  weights(clsnum);
+	vector<double>  cuts(clsnum);
+	vector<double>  dens(clsnum);
+	vector<double>  cdns(clsnum);
+	parallelRanges(clsnum, [&](size_t ib, size_t ie, unsigned) {
+		for(size_t i = ib; i < ie; ++i) {
+			const auto&  cl = *cls[i];
+			ids[i] = cl.id;
+			sizes[i] = cl.nnodes();
+			weights[i] = cl.weight();  // Internal (self-weight) of the cluster
+			// ATTENTION: ctxWeight(false) to load saved lower accuracy weight for the tidied context
+			const double  ctxweight = cl.ctxWeight(false);  // Full weight of the cluster
+			cuts[i] = ctxweight - weights[i];
+			dens[i] = sizes[i] ? weights[i] / sizes[i] : 0;
+			cdns[i] = ctxweight ? cuts[i] / ctxweight : 0;
+		}
+	}, workersNum(clsnum, 1 << 12, workers));
+
+	if(binary) {
+		CmbHeader  hdr;
+		memcpy(hdr.signature, CMB_SIGNATURE, sizeof hdr.signature);
+		hdr.version = CmbHeader::VERSION;
+		hdr.levsnum = m_hier.levels().size();
+		hdr.clsnum = clsnum;
+
+		//! Write the section padded to the 8 bytes alignment
+		auto put = [&fout](const void* data, size_t size) {
+			constexpr uint64_t  zero = 0;
+			if(fwrite(data, 1, size, fout) != size
+			|| (size != binAligned(size) && fwrite(&zero, 1, binAligned(size) - size, fout)
+				!= binAligned(size) - size))
+				throw std::ios_base::failure("ERROR metrics(), CMB writing failed\n");
+		};
+		put(&hdr, sizeof hdr);
+		put(levs.data(), clsnum * sizeof(uint32_t));
+		put(ids.data(), clsnum * sizeof(uint32_t));
+		put(sizes.data(), clsnum * sizeof(double));
+		put(weights.data(), clsnum * sizeof(double));
+		put(cuts.data(), clsnum * sizeof(double));
+		put(dens.data(), clsnum * sizeof(double));
+		put(cdns.data(), clsnum * sizeof(double));
+	} else {
+		fputs("Level,Id,Size,Weight,Cut,Density,Conductance\n", fout);
+		for(size_t i = 0; i < clsnum; ++i)
+			fprintf(fout, "%u,%u,%G,%.12G,%.12G,%.12G,%.12G\n", levs[i], ids[i]
+				, sizes[i], weights[i], cuts[i], dens[i], cdns[i]);
+		if(ferror(fout))
+			throw std::ios_base::failure("ERROR metrics(), the output failed\n");
+	}
+#if TRACE >= 2
+	fprintf(ftrace, " > metrics(), metrics of %lu clusters outputted\n", clsnum);
+#endif // TRACE
+}
+
+template <typename LinksT>
+size_t CnlPrinter<LinksT>::outpCluster(const Cluster<LinksT>& cl, const ClusterNodes<LinksT>& cnodes
+	, FILE* fout, bool outpnums, bool outpshares, bool fltMembers) noexcept
+{
+	constexpr Id  fltmask = Id(1) << (sizeof(Id) * 8 - 1);  // Node id filtering mask (the highest bit)
+	size_t  wbytes = 0;  // The number of written bytes
+	// Note: negative fprintf() results (errors) are not counted, the caller checks ferror()
+	auto countw = [&wbytes](int res) noexcept {
+		if(res > 0)
+			wbytes += res;
+	};
+	// Cluster id
+	if(outpnums)
+		countw(fprintf(fout, "%u> ", cl.id));
+	// Node shares
+	bool filtered = false;  // The cluster is filtered as nonempty
+	for(const auto& icn: cnodes) {  // first = dest, second = share
+		// Filter out marked nodes if required
+		if(fltMembers && icn.first->id & fltmask)
+			continue;
+		filtered = true;
+		if(outpshares
+		// Save share of all overlaps (0 <= share < 1)
+		//&& less(icn.second, Share(1))
+		// Save only unequal shares of the overlaps (fuzzy overlaps)
+		&& !equalx(icn.second, Share(1) / icn.first->owners.size()
+		, icn.first->owners.size()))  // Note: the number of owners is small
+			countw(fprintf(fout, "%u:%G ", icn.first->id, icn.second));
+		else countw(fprintf(fout, "%u ", icn.first->id));
+	}
+	if(filtered && fputc('\n', fout) != EOF)
+		++wbytes;
+	return wbytes;
+}
+
 }  // daoc
 
 #endif // PRINTER_CNL_HPP
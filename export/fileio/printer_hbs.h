@@ -0,0 +1,47 @@
+//! \brief Hierarchy printer in the Hierarchy Binary Snapshot format (.hbs).
+//! The Dao (Deterministic Agglomerative Overlapping) of Clustering library:
+//! Robust & Fine-grained Deterministic Clustering for Large Networks.
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#ifndef PRINTER_HBS_H
+#define PRINTER_HBS_H
+
+#include "fileio/iotypes.h"
+
+namespace daoc {
+
+template <typename LinksT>
+class HbsPrinter {
+	const Hierarchy<LinksT>&  m_hier;
+public:
+	// Note: SWIG uses transparent wrapper with shared_ptr
+    //! \brief Hierarchy printer in the HBS format
+    //!
+    //! \param hier const Hierarchy<LinksT>&  - the hierarchy to be outputted
+    //! \return
+	HbsPrinter(const Hierarchy<LinksT>& hier): m_hier(hier)  {}
+
+    //! \brief Hierarchy printer in the HBS format
+    //!
+    //! \param hier shared_ptr<Hierarchy<LinksT>>  - the hierarchy to be outputted
+    //! \return
+	HbsPrinter(shared_ptr<Hierarchy<LinksT>> hier): m_hier(*hier)  {}
+
+    //! \brief Output the hierarchy snapshot
+    //! \note The snapshot is loaded by HbsParser
+    //!
+    //! \param fout FileWrapper&  - output file opened in the binary mode
+    //! \return void
+	void output(FileWrapper& fout) const;
+};
+
+}  // daoc
+
+#endif // PRINTER_HBS_H
@@ -0,0 +1,136 @@
+//! \brief Hierarchy printer in the Hierarchy Binary Snapshot format (.hbs).
+//! The Dao (Deterministic Agglomerative Overlapping) of Clustering library:
+//! Robust & Fine-grained Deterministic Clustering for Large Networks.
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#ifndef PRINTER_HBS_HPP
+#define PRINTER_HBS_HPP
+
+#include <cstdio>
+#include <cstring>  // memcpy
+#include <ios>  // ios_base::failure
+
+#include "types.h"
+#include "flathash.hpp"  // FlatHashMap
+#include "fileio/printer_hbs.h"
+
+namespace daoc {
+
+// HBS Printer -----------------------------------------------------------------
+template <typename LinksT>
+void HbsPrinter<LinksT>::output(FileWrapper& fout) const
+{
+#if TRACE >= 2
+	fprintf(ftrace, " > output(), Starting hierarchy output in the HBS format\n");
+#endif // TRACE
+	//! Indexes of the clusters in the snapshot items
+	using ClusterIndexes = FlatHashMap<const Cluster<LinksT>*, uint32_t>;
+
+	// Form the header and index the clusters
+	HbsHeader  hdr;
+	memcpy(hdr.signature, HBS_SIGNATURE, sizeof hdr.signature);
+	hdr.version = HbsHeader::VERSION;
+	hdr.flags = HBS_NONE;
+#ifdef MEMBERSHARE_BYCANDS
+	hdr.flags |= HBS_SHARES;
+#endif // MEMBERSHARE_BYCANDS
+	if(m_hier.edges())
+		hdr.flags |= HBS_EDGES;
+	hdr.ndsnum = m_hier.nodes().size();
+	hdr.clsnum = 0;
+	hdr.ownsnum = 0;
+	hdr.links = m_hier.score().nodesLinks;
+	hdr.modularity = m_hier.score().modularity;
+	hdr.levsnum = m_hier.levels().size();
+	hdr.rootsnum = m_hier.root().size();
+
+	for(const auto& nd: m_hier.nodes())
+		hdr.ownsnum += nd.owners.size();
+	ClusterIndexes  clinds(m_hier.score().clusters);
+	uint32_t  icl = hdr.ndsnum;  // Index of the cluster in the items
+	for(const auto& lev: m_hier.levels())
+		for(const auto& cl: lev.clusters) {
+			clinds.emplace(&cl, icl++);
+			hdr.ownsnum += cl.owners.size();
+		}
+	hdr.clsnum = icl - hdr.ndsnum;
+
+	//! Write a binary value
+	auto put = [&fout](const void* val, size_t size) {
+		if(fwrite(val, 1, size, fout) != size)
+			throw std::ios_base::failure("ERROR output(), HBS writing failed\n");
+	};
+	//! Pad the written section to the 8 bytes alignment
+	auto align = [&put](uint64_t size) {
+		constexpr uint64_t  zero = 0;
+		if(size != binAligned(size))
+			put(&zero, binAligned(size) - size);
+	};
+	//! Apply the callback to all items: nodes and then clusters from the bottom level
+	auto traverse = [this](auto&& proc) {
+		for(const auto& nd: m_hier.nodes())
+			proc(nd);
+		for(const auto& lev: m_hier.levels())
+			for(const auto& cl: lev.clusters)
+				proc(cl);
+	};
+	const uint64_t  itemsnum = hdr.ndsnum + hdr.clsnum;
+
+	put(&hdr, sizeof hdr);
+	align(sizeof hdr);
+	// Levels
+	for(const auto& lev: m_hier.levels()) {
+		const HbsLevel  hlev = {static_cast<uint32_t>(lev.clusters.size()), static_cast<uint32_t>(lev.fullsize)};
+		put(&hlev, sizeof hlev);
+	}
+	align(hdr.levsnum * sizeof(HbsLevel));
+	// Items ids and weights
+	traverse([&put](const auto& el) {
+		const uint32_t  id = el.id;
+		put(&id, sizeof id);
+	});
+	align(itemsnum * sizeof(uint32_t));
+	traverse([&put](const auto& el) {
+		const double  weight = el.weight();
+		put(&weight, sizeof weight);
+	});
+	// Owners offsets, owners and their shares
+	uint64_t  ownoff = 0;
+	put(&ownoff, sizeof ownoff);
+	traverse([&put, &ownoff](const auto& el) {
+		ownoff += el.owners.size();
+		put(&ownoff, sizeof ownoff);
+	});
+	traverse([&put, &clinds](const auto& el) {
+		for(const auto& ow: el.owners) {
+			const uint32_t  iow = clinds.at(ow.dest);
+			put(&iow, sizeof iow);
+		}
+	});
+#ifdef MEMBERSHARE_BYCANDS
+	align(hdr.ownsnum * sizeof(uint32_t));
+	traverse([&put](const auto& el) {
+		for(const auto& ow: el.owners) {
+			const float  share = Share(ow.numac) / el.totac;
+			put(&share, sizeof share);
+		}
+	});
+	align(hdr.ownsnum * sizeof(float));
+#else
+	align(hdr.ownsnum * sizeof(uint32_t));
+#endif // MEMBERSHARE_BYCANDS
+#if TRACE >= 2
+	fprintf(ftrace, " > output(), Hierarchy output in the HBS format completed\n");
+#endif // TRACE
+}
+
+}  // daoc
+
+#endif // PRINTER_HBS_HPP
@@ -0,0 +1,238 @@
+//! \brief Binary (NumPy .npy) printer of the node vectorization.
+//! The Dao (Deterministic Agglomerative Overlapping) of Clustering library:
+//! Robust & Fine-grained Deterministic Clustering for Large Networks.
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#ifndef PRINTER_NPY_H
+#define PRINTER_NPY_H
+
+#include <cmath>  // round
+#include <limits>  // numeric_limits
+#include <utility>  // pair
+#include <algorithm>  // max
+#include <type_traits>  // is_integral, is_unsigned
+
+#include "fileio/iotypes.h"
+#include "types.h"  // Id, NodeVecFmtVal, NodeVecCoreOptions, LinkWeight
+
+namespace daoc {
+
+using std::pair;
+using std::numeric_limits;
+using std::is_integral;
+using std::is_unsigned;
+using std::max;
+
+// File Format related definitions ---------------------------------------------
+//! Binary formats of the node vectorization output
+enum class NodeVecBinFmt: uint8_t {
+	NONE = 0,  //!< No binary output, only the textual vectorization is produced
+	DENSE,  //!< Dense matrix (dims x nodes) in the NumPy .npy format
+	SPARSE  //!< Sparse CSR matrix (dims x nodes) as the .npy triple: indptr, indices, values
+};
+
+//! \brief Convert NodeVecBinFmt to string
+//! \relates NodeVecBinFmt
+//!
+//! \param flag NodeVecBinFmt  - the flag to be converted
+//! \return string  - resulting flag as a string
+inline string to_string(NodeVecBinFmt flag)
+{
+	switch(flag) {
+	case NodeVecBinFmt::DENSE:
+		return "DENSE";
+	case NodeVecBinFmt::SPARSE:
+		return "SPARSE";
+	default:
+		return "NONE";
+	}
+}
+
+//! Binary node vectorization output options
+struct NodeVecBinOptions {
+	NodeVecBinFmt  format;  //!< Binary output format
+	string  basename;  //!< Base name of the output .npy files without the extension
+	NodeVecFmtVal  value;  //!< Value format of the node projections
+	DimWeight  valmin;  //!< Min outputting value of the node projection
+
+	//! \brief Default constructor
+	//! \note The value format and valmin are the same as of the textual vectorization
+	NodeVecBinOptions(): format(NodeVecBinFmt::NONE), basename()
+		, value(NodeVecCoreOptions().value), valmin(NodeVecCoreOptions().valmin)  {}
+};
+
+// Accessory functions ---------------------------------------------------------
+//! \brief Quantize the node projection to the integral type
+//! \note The correction considers valmin to fit the whole range of VType
+//! 	into the outputting values
+//!
+//! \tparam VType  - target unsigned integral type
+//! \param wproj ValT  - node projection, E (0, 1]
+//! \param valmin ValT  - min outputting value of the node projection
+//! \return VType  - quantized value E [0, max(VType)], 0 means the value omission
+template <typename VType, typename ValT>
+inline VType quantNodeProj(ValT wproj, ValT valmin) noexcept
+{
+	static_assert(is_integral<VType>::value && is_unsigned<VType>::value
+		, "quantNodeProj(), unsigned integral VType is expected");
+	constexpr auto  vmax = numeric_limits<VType>::max();
+	const ValT  corr = max<ValT>(valmin - 0.5f / vmax, 0);
+	return round((wproj - corr) / (1 - corr) * vmax);
+}
+
+// NumPy array writer ----------------------------------------------------------
+//! \brief Streaming writer of a single array in the NumPy format v1.0
+//! \note The header is reserved on opening and finalized on closing,
+//! 	so the number of rows should not be known in advance.
+//! 	The output file should be seekable.
+class NpyWriter {
+	FileWrapper  m_file;  //!< Output file
+	string  m_descr;  //!< Array type descriptor as a Python literal (dtype)
+	size_t  m_cols;  //!< The number of columns, 0 for the 1D array
+	size_t  m_rows;  //!< The number of written rows (items for the 1D array)
+public:
+	//! Reserved size of the .npy header including the magic string, multiple of 64
+	static constexpr uint16_t  HDRSIZE = 256;
+
+	//! \brief Default constructor
+	NpyWriter() noexcept: m_file(), m_descr(), m_cols(0), m_rows(0)  {}
+
+	NpyWriter(const NpyWriter&)=delete;
+	NpyWriter& operator= (const NpyWriter&)=delete;
+
+	//! \brief Destructor, finalizes the array if it has not been closed
+	~NpyWriter();
+
+	//! \brief Open the .npy file and reserve its header
+	//! \note Throws ios_base::failure on the file opening failure
+	//!
+	//! \param filename const string&  - output file name
+	//! \param descr const string&  - type descriptor as a Python literal,
+	//! 	for example "'<f4'" or "[('id', '<u4'), ('val', '<f4')]"
+	//! \param cols=0 size_t  - the number of columns, 0 for the 1D array
+	//! \return void
+	void open(const string& filename, const string& descr, size_t cols=0);
+
+	//! \brief Whether the array is opened
+	explicit operator bool() const noexcept  { return m_file; }
+
+	//! \brief Write raw binary rows of the array
+	//!
+	//! \param data const void*  - the data to be written
+	//! \param size size_t  - size of the data in bytes
+	//! \param rows=1 size_t  - the number of rows (items for the 1D array) in the data
+	//! \return void
+	void write(const void* data, size_t size, size_t rows=1);
+
+	//! \brief The number of written rows
+	size_t rows() const noexcept  { return m_rows; }
+
+	//! \brief Finalize the header with the actual shape and close the file
+	//! \note Throws logic_error if the header does not fit the reserved space
+	//!
+	//! \return void
+	void close();
+};
+
+//! \brief Byte order prefix of the NumPy type descriptors for the current CPU
+//!
+//! \return char  - '<' for the little-endian and '>' for the big-endian
+char npyByteOrder() noexcept;
+
+// Binary node vectorization writer --------------------------------------------
+//! \brief Binary node vectorization writer
+//! \note Rows of the resulting matrix correspond to the dimensions (representative
+//! 	clusters) and columns to the nodes. Outputs the following .npy files
+//! 	for the specified basename:
+//! 	- DENSE: <basename>.npy  - dims x nodes matrix
+//! 	- SPARSE: <basename>.indptr.npy, <basename>.indices.npy, <basename>.values.npy
+//! 		- dims x nodes CSR matrix
+//! 	- <basename>.ids.npy  - node ids of the matrix columns
+//! 	- <basename>.diminfo.npy  - structured array of the dimensions info (the footer
+//! 		of the textual format) if not brief
+//! 	The integral values are quantized linearly: val = corr + (1 - corr) * v / max(VType),
+//! 	where corr = max(valmin - 0.5 / max(VType), 0); BIT values are 0/1.
+class NodeVecBinWriter {
+public:
+	using DimWeight = LinkWeight;  //!< Node projection value (weight)
+private:
+	using RowItem = pair<Id, DimWeight>;  //!< Column index and the node projection
+	using RowItems = vector<RowItem>;
+	using Bytes = vector<uint8_t>;
+
+	string  m_basename;  //!< Base name of the output files
+	NodeVecBinFmt  m_fmt;  //!< Binary output format
+	NodeVecFmtVal  m_valfmt;  //!< Value format
+	DimWeight  m_valmin;  //!< Min outputting value of the node projection
+	uint8_t  m_valsize;  //!< Size of the value in bytes
+	NpyWriter  m_mat;  //!< Dense matrix or CSR values
+	NpyWriter  m_indptr;  //!< CSR row pointers
+	NpyWriter  m_indices;  //!< CSR column indices
+	NpyWriter  m_ids;  //!< Node ids of the columns
+	NpyWriter  m_dims;  //!< Dimensions info
+	Id  m_ncols;  //!< The number of columns (nodes)
+	uint64_t  m_nnz;  //!< The number of nonzero values written to the sparse matrix
+	RowItems  m_row;  //!< Items of the processing row (dimension)
+	Bytes  m_buf;  //!< Encoded row values
+	vector<uint32_t>  m_icols;  //!< Column indices of the processing sparse row
+public:
+	//! \brief Binary node vectorization writer constructor
+	//!
+	//! \param basename const string&  - base name of the output files without the extension
+	//! \param fmt NodeVecBinFmt  - binary output format
+	//! \param valfmt NodeVecFmtVal  - value format
+	//! \param valmin DimWeight  - min outputting value of the node projection
+	NodeVecBinWriter(const string& basename, NodeVecBinFmt fmt, NodeVecFmtVal valfmt
+		, DimWeight valmin);
+
+	//! \brief Whether the binary output is performed
+	explicit operator bool() const noexcept  { return m_fmt != NodeVecBinFmt::NONE; }
+
+	//! \brief Output the node ids of the columns and open the matrix files
+	//! \pre Should be called before any row is added
+	//!
+	//! \param nodes const NodesT&  - nodes (having id attribute) in the order of columns
+	//! \return void
+	template <typename NodesT>
+	void columns(const NodesT& nodes);
+
+	//! \brief Add the node projection to the processing row (dimension)
+	//! \pre icol is not present in the processing row
+	//!
+	//! \param icol Id  - column (node) index
+	//! \param wproj DimWeight  - node projection, >= valmin
+	//! \return bool  - the value is nonzero in the target value format and is added
+	bool add(Id icol, DimWeight wproj);
+
+	//! \brief Commit the processing row (dimension) to the matrix
+	//!
+	//! \return void
+	void commit();
+
+	//! \brief Discard the processing row (dimension)
+	void discard() noexcept  { m_row.clear(); }
+
+	//! \brief Output the dimensions info
+	//!
+	//! \param dinfos const DimInfosT&  - dimensions info having id, levid, rdens,
+	//! 	rweight, wsim, wdis and root attributes
+	//! \return void
+	template <typename DimInfosT>
+	void diminfos(const DimInfosT& dinfos);
+
+	//! \brief Finalize all the outputting arrays
+	//!
+	//! \return void
+	void close();
+};
+
+}   // daoc
+
+#endif // PRINTER_NPY_H
@@ -0,0 +1,291 @@
+//! \brief Binary (NumPy .npy) printer of the node vectorization.
+//! The Dao (Deterministic Agglomerative Overlapping) of Clustering library:
+//! Robust & Fine-grained Deterministic Clustering for Large Networks.
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#ifndef PRINTER_NPY_HPP
+#define PRINTER_NPY_HPP
+
+#include <cstdio>
+#include <cstring>  // memcpy, memset
+#include <stdexcept>  // logic_error
+#include <ios>  // ios_base::failure
+#include <algorithm>  // sort
+
+#include "arithmetic.hpp"  // CPU_LITTLE_ENDIAN
+#include "operations.hpp"  // less, equal
+#include "fileio/printer_npy.h"
+
+
+namespace daoc {
+
+using std::logic_error;
+
+// NumPy array writer ----------------------------------------------------------
+inline char npyByteOrder() noexcept
+{
+	return CPU_LITTLE_ENDIAN ? '<' : '>';
+}
+
+inline NpyWriter::~NpyWriter()
+{
+	if(m_file) {
+		try {
+			close();
+		} catch(std::exception& err) {
+			fprintf(stderr, "WARNING ~NpyWriter(), the array finalization failed: %s\n", err.what());
+		}
+	}
+}
+
+inline void NpyWriter::open(const string& filename, const string& descr, size_t cols)
+{
+	if(m_file)
+		close();
+	m_file.reset(fopen(filename.c_str(), "wb"));
+	if(!m_file)
+		throw std::ios_base::failure(string("ERROR open(), the .npy file can't be created: ")
+			.append(filename) += '\n');
+	m_descr = descr;
+	m_cols = cols;
+	m_rows = 0;
+	// Reserve the header, it is finalized on close() when the shape is known
+	char  hdr[HDRSIZE];
+	memset(hdr, ' ', HDRSIZE);
+	if(fwrite(hdr, 1, HDRSIZE, m_file) != HDRSIZE)
+		throw std::ios_base::failure(string("ERROR open(), the .npy header reservation failed: ")
+			.append(filename) += '\n');
+}
+
+inline void NpyWriter::write(const void* data, size_t size, size_t rows)
+{
+#if VALIDATE >= 2
+	assert(m_file && "write(), the array should be opened");
+#endif // VALIDATE
+	if(size && fwrite(data, 1, size, m_file) != size)
+		throw std::ios_base::failure("ERROR write(), the .npy data writing failed\n");
+	m_rows += rows;
+}
+
+inline void NpyWriter::close()
+{
+	if(!m_file)
+		return;
+	// Header dictionary: {'descr': <descr>, 'fortran_order': False, 'shape': (rows[, cols]), }
+	string  dict = string("{'descr': ").append(m_descr).append(", 'fortran_order': False, 'shape': (")
+		.append(std::to_string(m_rows));
+	if(m_cols)
+		dict.append(", ").append(std::to_string(m_cols));
+	else dict += ',';
+	dict.append("), }");
+	// Magic (6) + version (2) + header length (2) + the dictionary padded with spaces + '\n'
+	constexpr uint8_t  preflen = 10;
+	if(preflen + dict.size() + 1 > HDRSIZE) {
+		m_file.reset();
+		throw logic_error(string("close(), the .npy header exceeds the reserved space: ")
+			.append(dict) += '\n');
+	}
+	dict.resize(HDRSIZE - preflen - 1, ' ');
+	dict += '\n';
+	const uint16_t  hdrlen = dict.size();
+	const uint8_t  pref[preflen] = {0x93, 'N', 'U', 'M', 'P', 'Y', 1, 0
+		, uint8_t(hdrlen & 0xFF), uint8_t(hdrlen >> 8)};  // Header length is little-endian
+	fseek(m_file, 0, SEEK_SET);
+	const bool  fail = fwrite(pref, 1, preflen, m_file) != preflen
+		|| fwrite(dict.data(), 1, dict.size(), m_file) != dict.size();
+	m_file.reset();
+	if(fail)
+		throw std::ios_base::failure("ERROR close(), the .npy header writing failed\n");
+}
+
+// Binary node vectorization writer --------------------------------------------
+inline NodeVecBinWriter::NodeVecBinWriter(const string& basename, NodeVecBinFmt fmt
+	, NodeVecFmtVal valfmt, DimWeight valmin)
+: m_basename(basename), m_fmt(fmt), m_valfmt(valfmt), m_valmin(valmin), m_valsize(0)
+, m_mat(), m_indptr(), m_indices(), m_ids(), m_dims(), m_ncols(0), m_nnz(0), m_row(), m_buf(), m_icols()
+{
+	switch(valfmt) {
+	case NodeVecFmtVal::BIT:
+	case NodeVecFmtVal::UINT8:
+		m_valsize = sizeof(uint8_t);
+		break;
+	case NodeVecFmtVal::UINT16:
+		m_valsize = sizeof(uint16_t);
+		break;
+	case NodeVecFmtVal::FLOAT32:
+		m_valsize = sizeof(float);
+		break;
+	default:
+		throw invalid_argument(string("NodeVecBinWriter(), invalid value format: ")
+			.append(to_string(valfmt)) += '\n');
+	}
+}
+
+template <typename NodesT>
+void NodeVecBinWriter::columns(const NodesT& nodes)
+{
+	if(m_fmt == NodeVecBinFmt::NONE)
+		return;
+#if VALIDATE >= 2
+	assert(!m_mat && "columns(), the matrix should not be opened yet");
+#endif // VALIDATE
+	// Node ids of the columns
+	const char  bord = npyByteOrder();
+	m_ncols = nodes.size();
+	m_ids.open(m_basename + ".ids.npy", string("'").append(1, bord).append("u4'"));
+	for(const auto& nd: nodes) {
+		const uint32_t  id = nd.id;
+		m_ids.write(&id, sizeof id);
+	}
+	m_ids.close();
+
+	// Matrix
+	string  descr("'");
+	switch(m_valfmt) {
+	case NodeVecFmtVal::BIT:
+	case NodeVecFmtVal::UINT8:
+		descr.append("|u1'");
+		break;
+	case NodeVecFmtVal::UINT16:
+		descr.append(1, bord).append("u2'");
+		break;
+	default:
+		descr.append(1, bord).append("f4'");
+	}
+	if(m_fmt == NodeVecBinFmt::DENSE) {
+		m_mat.open(m_basename + ".npy", descr, m_ncols);
+		m_buf.assign(static_cast<size_t>(m_ncols) * m_valsize, 0);
+	} else {
+		m_mat.open(m_basename + ".values.npy", descr);
+		m_indices.open(m_basename + ".indices.npy", string("'").append(1, bord).append("u4'"));
+		m_indptr.open(m_basename + ".indptr.npy", string("'").append(1, bord).append("u8'"));
+		m_nnz = 0;
+		m_indptr.write(&m_nnz, sizeof m_nnz);
+	}
+}
+
+inline bool NodeVecBinWriter::add(Id icol, DimWeight wproj)
+{
+#if VALIDATE >= 2
+	assert(icol < m_ncols && "add(), column index is out of range");
+#endif // VALIDATE
+	bool  nonzero = false;
+	switch(m_valfmt) {
+	case NodeVecFmtVal::BIT:
+		nonzero = !less<DimWeight>(wproj, 0.5);
+		break;
+	case NodeVecFmtVal::UINT8:
+		nonzero = quantNodeProj<uint8_t>(wproj, m_valmin);
+		break;
+	case NodeVecFmtVal::UINT16:
+		nonzero = quantNodeProj<uint16_t>(wproj, m_valmin);
+		break;
+	default:
+		nonzero = !equal<DimWeight>(wproj);
+	}
+	if(nonzero)
+		m_row.emplace_back(icol, wproj);
+	return nonzero;
+}
+
+inline void NodeVecBinWriter::commit()
+{
+	if(!m_mat) {
+		m_row.clear();
+		return;
+	}
+	//! Encode the value to the specified position
+	auto encode = [this](uint8_t* pos, DimWeight wproj) noexcept {
+		switch(m_valfmt) {
+		case NodeVecFmtVal::BIT:
+			*pos = 1;
+			break;
+		case NodeVecFmtVal::UINT8:
+			*pos = quantNodeProj<uint8_t>(wproj, m_valmin);
+			break;
+		case NodeVecFmtVal::UINT16: {
+			const uint16_t  v = quantNodeProj<uint16_t>(wproj, m_valmin);
+			memcpy(pos, &v, sizeof v);
+		} break;
+		default: {
+			const float  v = wproj;
+			memcpy(pos, &v, sizeof v);
+		}
+		}
+	};
+
+	if(m_fmt == NodeVecBinFmt::DENSE) {
+		for(const auto& rit: m_row)
+			encode(&m_buf[static_cast<size_t>(rit.first) * m_valsize], rit.second);
+		m_mat.write(m_buf.data(), m_buf.size());
+		// Reset only the touched values
+		for(const auto& rit: m_row)
+			memset(&m_buf[static_cast<size_t>(rit.first) * m_valsize], 0, m_valsize);
+	} else {
+		// Note: the canonical CSR format has ordered column indices
+		std::sort(m_row.begin(), m_row.end(), [](const RowItem& a, const RowItem& b) noexcept {
+			return a.first < b.first;
+		});
+		m_buf.resize(m_row.size() * m_valsize);
+		m_icols.resize(m_row.size());
+		auto  pos = m_buf.data();
+		auto  icol = m_icols.begin();
+		for(const auto& rit: m_row) {
+			*icol++ = rit.first;
+			encode(pos, rit.second);
+			pos += m_valsize;
+		}
+		m_indices.write(m_icols.data(), m_icols.size() * sizeof(uint32_t), m_icols.size());
+		m_mat.write(m_buf.data(), m_buf.size(), m_row.size());
+		m_nnz += m_row.size();
+		m_indptr.write(&m_nnz, sizeof m_nnz);
+	}
+	m_row.clear();
+}
+
+template <typename DimInfosT>
+void NodeVecBinWriter::diminfos(const DimInfosT& dinfos)
+{
+	if(m_fmt == NodeVecBinFmt::NONE)
+		return;
+	const string  bord(1, npyByteOrder());
+	m_dims.open(m_basename + ".diminfo.npy", string("[('id', '").append(bord)
+		.append("u4'), ('levid', '").append(bord).append("u4'), ('rdens', '").append(bord)
+		.append("f4'), ('rweight', '").append(bord).append("f4'), ('wsim', '").append(bord)
+		.append("f4'), ('wdis', '").append(bord).append("f4'), ('root', '|u1')]"));
+	// Packed record of the structured array
+	constexpr uint8_t  recsize = sizeof(uint32_t) * 2 + sizeof(float) * 4 + sizeof(uint8_t);
+	Bytes  recs(dinfos.size() * recsize);
+	auto  pos = recs.data();
+	for(const auto& dinf: dinfos) {
+		const uint32_t  ids[] = {dinf.id, static_cast<uint32_t>(dinf.levid)};
+		const float  vals[] = {dinf.rdens, dinf.rweight, dinf.wsim, dinf.wdis};
+		memcpy(pos, ids, sizeof ids);
+		pos += sizeof ids;
+		memcpy(pos, vals, sizeof vals);
+		pos += sizeof vals;
+		*pos++ = dinf.root;
+	}
+	m_dims.write(recs.data(), recs.size(), dinfos.size());
+	m_dims.close();
+}
+
+inline void NodeVecBinWriter::close()
+{
+	m_row.clear();
+	m_mat.close();
+	m_indices.close();
+	m_indptr.close();
+	m_dims.close();
+}
+
+}  // daoc
+
+#endif // PRINTER_NPY_HPP
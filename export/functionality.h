@@ -13,6 +13,9 @@
 #ifndef FUNCTIONALITY_H
 #define FUNCTIONALITY_H
 
+#include <future>  // async, shared_future
+#include <chrono>  // duration
+
 #include "types.h"  // Clusters, ...
 
 
@@ -59,6 +62,77 @@ shared_ptr<Hierarchy<LinksT>> cluster(
 	return cluster(*nodes, edges, opts);
 }
 
+#ifndef SWIG
+//! \brief Perform clustering asynchronously in a dedicated thread
+//! \note The nodes should not be accessed until the clustering completion
+//!
+//! \tparam LinksT  - type of items links
+//!
+//! \param nodes shared_ptr<Nodes<LinksT>>  - nodes with ORDERED links to be
+//! 	clustered, retained until the clustering completion
+//! \param edges bool  - whether links are edges with symmetric weights, see cluster()
+//! \param opts=ClusterOptions() const ClusterOptions&  - clustering options, copied
+//! \return std::shared_future<shared_ptr<Hierarchy<LinksT>>>  - resulting hierarchy,
+//! 	rethrows the clustering exception on get()
+template <typename LinksT>
+std::shared_future<shared_ptr<Hierarchy<LinksT>>> clusterAsync(shared_ptr<Nodes<LinksT>> nodes
+	, bool edges, const ClusterOptions& opts=ClusterOptions())
+{
+	return std::async(std::launch::async, [nodes, edges, opts]() {
+		return cluster<LinksT>(*nodes, edges, opts);
+	}).share();
+}
+#endif // SWIG
+
+//! \brief Clustering task: handle of the asynchronous clustering
+//! \note Destruction of the last handle waits for the clustering completion
+//!
+//! \tparam LinksT  - type of items links
+template <typename LinksT>
+class ClusteringTask {
+	std::shared_future<shared_ptr<Hierarchy<LinksT>>>  m_res;  //!< Resulting hierarchy
+public:
+    //! \brief Start the clustering, see clusterAsync()
+    //!
+    //! \param nodes shared_ptr<Nodes<LinksT>>  - nodes with ORDERED links to be
+    //! 	clustered, retained until the clustering completion
+    //! \param edges bool  - whether links are edges with symmetric weights, see cluster()
+    //! \param opts=ClusterOptions() const ClusterOptions&  - clustering options, copied
+	ClusteringTask(shared_ptr<
+#ifndef SWIG
+		Nodes<LinksT>
+#else
+		Nodes(LinksT)
+#endif // SWIG
+	> nodes, bool edges, const ClusterOptions& opts=ClusterOptions())
+	: m_res(clusterAsync<LinksT>(std::move(nodes), edges, opts))  {}
+
+    //! \brief Whether the clustering is completed (successfully or not)
+    //!
+    //! \return bool  - the result is ready
+	bool ready() const
+	{ return m_res.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }
+
+    //! \brief Wait for the clustering completion
+    //!
+    //! \param timeout=-1 double  - timeout in seconds, negative for the unlimited one
+    //! \return bool  - the result is ready
+	bool wait(double timeout=-1) const
+	{
+		if(timeout < 0) {
+			m_res.wait();
+			return true;
+		}
+		return m_res.wait_for(std::chrono::duration<double>(timeout)) == std::future_status::ready;
+	}
+
+    //! \brief Resulting hierarchy, waits for the clustering completion
+    //! \note Rethrows the clustering exception if any
+    //!
+    //! \return shared_ptr<Hierarchy<LinksT>>  - resulting hierarchy
+	shared_ptr<Hierarchy<LinksT>> get() const  { return m_res.get(); }
+};
+
 // External interface implemented in processing.hpp ----------------------------
 //! \brief Evaluate specified intrinsic clustering measures
 //! \note Clusters might contain selflinks and undefined context
@@ -14,6 +14,7 @@
 #define GRAPH_H
 
 #include <initializer_list>
+#include <cstdio>  // fprintf
 
 #include "types.h"  // LinkWeight, IdItems (nodes mapping)
 
@@ -80,6 +81,52 @@ struct InpLink<false> {
 #endif // DAOC_SWIGPROC
 };
 
+//! \brief Count-only errors accumulator retaining a bounded sample of the errors
+//! \note Keeps the memory flat on the heavily erroneous input, for example the
+//! 	edge lists listing each edge in both directions yield a duplicated link
+//! 	per edge
+//!
+//! \tparam ErrsT  - accumulator of the sampled errors: StructLinkErrors, StructNodeErrors
+template <typename ErrsT>
+class CountedErrors {
+	ErrsT  m_sample;  //!< Sampled errors
+	size_t  m_num;  //!< The number of the occurred errors
+	const size_t  m_smax;  //!< Max number of the sampled errors
+public:
+    //! \brief CountedErrors constructor
+    //!
+    //! \param msg const char*  - errors message to be shown
+    //! \param smax=32 size_t  - max number of the sampled errors
+	CountedErrors(const char* msg, size_t smax=32)
+	: m_sample(msg), m_num(0), m_smax(smax)  {}
+
+    //! \brief Register the error
+    //!
+    //! \param err const ItemT&  - the occurred error to be sampled
+    //! \return void
+	template <typename ItemT>
+	void add(const ItemT& err)
+	{
+		if(m_num++ < m_smax)
+			m_sample.add(err);
+	}
+
+    //! \brief The number of the occurred errors
+    //!
+    //! \return size_t  - the number of errors
+	size_t num() const noexcept  { return m_num; }
+
+    //! \brief Show the sampled errors and the total number of errors
+    //!
+    //! \return void
+	void show()
+	{
+		m_sample.show();
+		if(m_num > m_smax)
+			fprintf(ftrace, "  ... %lu errors in total, %lu are shown\n", m_num, m_smax);
+	}
+};
+
 //! \brief Nodes Graph to couple nodes externally
 //! \note Back links must always exist even with zero weight
 //!
@@ -208,6 +255,14 @@ public:
 	inline void reset(Id nodesNum=0, bool shuffle=false, bool sumdups=false //, bool reduce=false
 		, Reduction reduction=Reduction::NONE);
 
+    //! \brief Deep copy of the graph nodes and links
+    //! \note The nodes are copied without their owners and the hierarchy is not
+    //! 	copied. The graph is only read, so the replicas can be formed concurrently.
+    //! 	Can be used to load multiple clusterings, since loading resets the graph.
+    //!
+    //! \return Graph  - the graph replica
+	Graph replica() const;
+
     //! \brief Release nodes from the graph leaving it empty
     //! \post The graph becomes reseted to the state before the nodes filling
     //! \attention directed flag is reseted
@@ -303,14 +358,16 @@ public:
     //! 		=> Graph weight is doubled (including node weights via self-links)
     //!
     //! \tparam DIRECTED bool  - whether links are directed
+    //! \tparam ErrsT  - accumulator of the link errors
     //! \param node Id  - source node id
     //! \param links InpLinksT&&  - node links
-	//! \param lnerrs=nullptr StructLinkErrors*  - occurred accumulated link errors
-	//! 	to be reported by the caller (duplicated discarded links)
+	//! \param lnerrs=nullptr ErrsT*  - occurred accumulated link errors
+	//! 	to be reported by the caller (duplicated discarded links),
+	//! 	StructLinkErrors or CountedErrors<StructLinkErrors>
     //! \return void
-	template <bool DIRECTED>
+	template <bool DIRECTED, typename ErrsT=StructLinkErrors>
 	inline void addNodeLinks(Id node, Links<InpLink<LINKS_WEIGHTED>>&& links
-		, StructLinkErrors* lnerrs=nullptr);
+		, ErrsT* lnerrs=nullptr);
 
 #ifndef SWIG
 	// Note: SWIG does not fully support initializer_list
@@ -326,14 +383,16 @@ public:
     //! 		=> Graph weight is doubled (including node weights via self-links)
     //!
     //! \tparam DIRECTED bool  - whether links are directed
+    //! \tparam ErrsT  - accumulator of the link errors
     //! \param node Id  - source node id
     //! \param links const initializer_list<InpLinkT>&  - node links
-	//! \param lnerrs=nullptr StructLinkErrors*  - occurred accumulated link errors
-	//! 	to be reported by the caller (duplicated discarded links)
+	//! \param lnerrs=nullptr ErrsT*  - occurred accumulated link errors
+	//! 	to be reported by the caller (duplicated discarded links),
+	//! 	StructLinkErrors or CountedErrors<StructLinkErrors>
     //! \return void
-	template <bool DIRECTED>
+	template <bool DIRECTED, typename ErrsT=StructLinkErrors>
 	inline void addNodeLinks(Id node, const initializer_list<InpLinkT>& links
-		, StructLinkErrors* lnerrs=nullptr);
+		, ErrsT* lnerrs=nullptr);
 #endif // SWIG
 
     //! \brief Add node links to the Graph
@@ -348,14 +407,16 @@ public:
     //! 		=> Graph weight is doubled (including node weights via self-links)
     //!
     //! \tparam DIRECTED bool  - whether links are directed
+    //! \tparam ErrsT  - accumulator of the link errors
     //! \param node Id  - source node id
     //! \param links InpLinksT&&  - node links
-	//! \param lnerrs=nullptr StructLinkErrors*  - occurred accumulated link errors
-	//! 	to be reported by the caller (duplicated discarded links)
+	//! \param lnerrs=nullptr ErrsT*  - occurred accumulated link errors
+	//! 	to be reported by the caller (duplicated discarded links),
+	//! 	StructLinkErrors or CountedErrors<StructLinkErrors>
     //! \return void
-	template <bool DIRECTED>
+	template <bool DIRECTED, typename ErrsT=StructLinkErrors>
 	inline void addNodeAndLinks(Id node, Links<InpLink<LINKS_WEIGHTED>>&& links
-		, StructLinkErrors* lnerrs=nullptr);
+		, ErrsT* lnerrs=nullptr);
 
     //! \brief Add node link to the Graph
     //! \pre The node ids must refer to already existing nodes
@@ -365,16 +426,61 @@ public:
 	//! 	to be consistent with the subsequent (self) weight aggregation on clusters formation.
     //!
     //! \tparam DIRECTED bool  - whether links are directed
+    //! \tparam ErrsT  - accumulator of the link errors
     //! \param snode Id  - source node id
     //! \param dnode Id  - destination node id
     //! \param weight=SimpleLink<Weight>::weight LinkWeight  - link weight,
     //! 	ignored for unweighted links
-	//! \param lnerrs=nullptr StructLinkErrors*  - occurred accumulated link errors
-	//! 	to be reported by the caller (duplicated discarded links)
+	//! \param lnerrs=nullptr ErrsT*  - occurred accumulated link errors
+	//! 	to be reported by the caller (duplicated discarded links),
+	//! 	StructLinkErrors or CountedErrors<StructLinkErrors>
     //! \return void
-	template <bool DIRECTED>
+	template <bool DIRECTED, typename ErrsT=StructLinkErrors>
 	inline void addLink(Id snode, Id dnode, LinkWeight weight=SimpleLink<LinkWeight>::weight
-		, StructLinkErrors* lnerrs=nullptr);
+		, ErrsT* lnerrs=nullptr);
+
+    //! \brief Add links specified by the arrays of the src and dest node ids
+    //! 	(COO format) to the Graph
+    //! \post Referred nodes are added if not existed
+    //! \note The arrays are not copied. The links are grouped by the src ids
+    //! 	(stable, unless already grouped) and all links of the src node are
+    //! 	added in a single batch like in addNodeAndLinks().
+    //! \attention See addNodeAndLinks()
+    //!
+    //! \tparam DIRECTED bool  - whether links are directed
+    //! \tparam ErrsT  - accumulator of the link errors
+    //! \param srcs const Id*  - src node ids of the links
+    //! \param dsts const Id*  - dest node ids of the links
+    //! \param weights const LinkWeight*  - link weights, nullptr for the default
+    //! 	weight, should be nullptr for the unweighted links
+    //! \param num size_t  - the number of links (size of each array)
+	//! \param lnerrs=nullptr ErrsT*  - occurred accumulated link errors
+	//! 	to be reported by the caller (duplicated discarded links)
+    //! \return void
+	template <bool DIRECTED, typename ErrsT=StructLinkErrors>
+	void addLinks(const Id* srcs, const Id* dsts, const LinkWeight* weights, size_t num
+		, ErrsT* lnerrs=nullptr);
+
+    //! \brief Add links specified by the adjacency matrix in the CSR format
+    //! 	(compressed sparse rows) to the Graph
+    //! \post Nodes with ids 0 .. nodesNum - 1 are added if not existed
+    //! \note The arrays are not copied. Links of each row are added in a single
+    //! 	batch like in addNodeLinks().
+    //! \attention See addNodeLinks()
+    //!
+    //! \tparam DIRECTED bool  - whether links are directed
+    //! \tparam ErrsT  - accumulator of the link errors
+    //! \param indptr const Size*  - offsets of the rows in the indices, nodesNum + 1 items
+    //! \param nodesNum Id  - the number of rows, each row i specifies links of the node #i
+    //! \param indices const Id*  - dest node ids, < nodesNum, indptr[nodesNum] items
+    //! \param weights const LinkWeight*  - link weights, nullptr for the default
+    //! 	weight, should be nullptr for the unweighted links
+	//! \param lnerrs=nullptr ErrsT*  - occurred accumulated link errors
+	//! 	to be reported by the caller (duplicated discarded links)
+    //! \return void
+	template <bool DIRECTED, typename ErrsT=StructLinkErrors>
+	void addCsrLinks(const Size* indptr, Id nodesNum, const Id* indices
+		, const LinkWeight* weights, ErrsT* lnerrs=nullptr);
 
     //! \brief Cluster the graph producing hierarchy of clusters
     //! \post Nodes are moved to the hierarchy (their addresses are remained) and
@@ -15,7 +15,6 @@
 
 #include <stdexcept>
 #include <random>
-#include <unordered_set>
 #include <algorithm>  // sort(), swap(), max(), move[container items]()
 
 #if TRACE >= 1
@@ -23,6 +22,8 @@
 #endif // TRACE
 
 #include "operations.hpp"
+#include "flathash.hpp"  // FlatHashSet
+#include "parallel.hpp"  // parallelRanges, workersNum
 #include "functionality.h"
 #include "graph.h"
 
@@ -32,7 +33,6 @@ using std::runtime_error;
 using std::logic_error;
 using std::random_device;
 using std::enable_if_t;
-using std::unordered_set;
 using std::sort;
 using std::min;
 using std::forward;
@@ -59,11 +59,11 @@ static random_device  rdev;  // Random numbers generator
 //! \param dst NodeT*  - dest node
 //! \param weight WeightT  - links weight to the dest node
 //! \param sumdups bool  - accumulate (sum) weight of duplicated links or just skip them
-//! \param errs StructLinkErrors*  - occurred accumulated errors to be reported by the caller
+//! \param errs ErrsT*  - occurred accumulated errors to be reported by the caller
 //! \return void
-template <typename NodeT, typename WeightT>
+template <typename NodeT, typename WeightT, typename ErrsT>
 enable_if_t<NodeT::links_type::value_type::IS_WEIGHTED>
-insertLink(NodeT* src, NodeT* dst, WeightT weight, bool sumdups, StructLinkErrors* errs)
+insertLink(NodeT* src, NodeT* dst, WeightT weight, bool sumdups, ErrsT* errs)
 {
 #if VALIDATE >= 2
 	assert(src != dst && "insertLink(), a non-selflink is expected");
@@ -87,9 +87,9 @@ insertLink(NodeT* src, NodeT* dst, WeightT weight, bool sumdups, StructLinkError
 }
 
 //! \copydoc insertLink
-template <typename NodeT, typename WeightT>
+template <typename NodeT, typename WeightT, typename ErrsT>
 enable_if_t<!NodeT::links_type::value_type::IS_WEIGHTED>
-insertLink(NodeT* src, NodeT* dst, WeightT weight, bool sumdups, StructLinkErrors* errs)
+insertLink(NodeT* src, NodeT* dst, WeightT weight, bool sumdups, ErrsT* errs)
 {
 #if VALIDATE >= 2
 	assert(src != dst && (weight == SimpleLink<WeightT>::weight)
@@ -189,11 +189,11 @@ void acsAddNodes(NodesT& nodes, IdNodesT& idNodes, const NodesIdsT& nodesIds
 //! \param dst NodeT*  - destination node for the link
 //! \param weight WeightT  - link weight
 //! \param sumdups bool  - accumulate weight of duplicated links or just skip them
-//! \param errs StructLinkErrors*  - occurred accumulated errors to be reported by the caller
+//! \param errs ErrsT*  - occurred accumulated errors to be reported by the caller
 //! \return bool  - directed non-self link added
 // ATTENTION: interpretation of the directed links should be synced with acsReduceLinks()
-template <bool DIRECTED, typename NodeT, typename WeightT>
-bool acsAddNodeLink(NodeT* nd, NodeT* dst, WeightT weight, bool sumdups, StructLinkErrors* errs)
+template <bool DIRECTED, typename NodeT, typename WeightT, typename ErrsT>
+bool acsAddNodeLink(NodeT* nd, NodeT* dst, WeightT weight, bool sumdups, ErrsT* errs)
 {
 	static_assert(is_floating_point<WeightT>::value
 		, "acsAddNodeLink(), WeightT should be a floating point type");
@@ -250,23 +250,23 @@ bool acsAddNodeLink(NodeT* nd, NodeT* dst, WeightT weight, bool sumdups, StructL
 //! \param reduction Reduction  - core node links reduction policy
 //! \param rlsmin Id  - min number of links to retain, 0 means omit the reduction
 //! \param sumdups bool  - accumulate weight of duplicated links or just skip them
-//! \param errs StructLinkErrors*  - occurred accumulated errors to be reported by the caller
+//! \param errs ErrsT*  - occurred accumulated errors to be reported by the caller
 //! \return void
 ////! \return typename InpLinksT::iterator  - end iterator of the reduction range
-template <bool DIRECTED, typename NodeT, typename InpLinksT, typename IdNodesT>
+template <bool DIRECTED, typename NodeT, typename InpLinksT, typename IdNodesT, typename ErrsT>
 enable_if_t<!(DIRECTED && InpLinksT::value_type::IS_WEIGHTED)>
 acsReduceLinks(NodeT& node, InpLinksT& links, const IdNodesT& idNodes
-	, Reduction reduction, Id rlsmin, bool sumdups, StructLinkErrors* errs)
+	, Reduction reduction, Id rlsmin, bool sumdups, ErrsT* errs)
 {
 	// Note: unweighted links can't be reduced
 	throw logic_error("acsReduceLinks() should not be called for the unweighed or undirected node links\n");
 }
 
 // NOTE: only directed weighted links can be reduced by the input graph
-template <bool DIRECTED, typename NodeT, typename InpLinksT, typename IdNodesT>
+template <bool DIRECTED, typename NodeT, typename InpLinksT, typename IdNodesT, typename ErrsT>
 enable_if_t<DIRECTED && InpLinksT::value_type::IS_WEIGHTED>
 acsReduceLinks(NodeT& node, InpLinksT& links, const IdNodesT& idNodes
-	, Reduction reduction, Id rlsmin, bool sumdups, StructLinkErrors* errs)
+	, Reduction reduction, Id rlsmin, bool sumdups, ErrsT* errs)
 {
 	// Note: this function should be synced with reduceLinks()
 	// Note: the links are weighted
@@ -363,8 +363,9 @@ acsReduceLinks(NodeT& node, InpLinksT& links, const IdNodesT& idNodes
 	// Update heavy weights border
 	ih = il;
 	// Reduce links [ilb, ih) transforming to the node weights, check for the self-link is not required
-	// NOTE: should be stored in the TLS in case of the parallel implementation
-	static unordered_set<Id, SolidHash<Id>>  ids;  // Destination ids to control duplicates
+	// Note: the graphs can be built concurrently (the parsers release the GIL
+	// in the Python bindings), so the reused container is thread local
+	static thread_local FlatHashSet<Id>  ids;  // Destination ids to control duplicates
 #if VALIDATE >= 2
 	assert(ids.empty() && "acsReduceLinks(), an empty container is expected");
 #endif // VALIDATE
@@ -422,11 +423,11 @@ acsReduceLinks(NodeT& node, InpLinksT& links, const IdNodesT& idNodes
 //! \param sumdups bool  - accumulate weight of duplicated links or just skip them
 //! \param reduction Reduction  - core node links reduction policy
 //! \param rlsmin Id  - minimal number of links after the reduction, 0 means omit the reduction
-//! \param errs StructLinkErrors*  - occurred accumulated link errors to be reported by the caller
+//! \param errs ErrsT*  - occurred accumulated link errors to be reported by the caller
 //! \return bool  - directed links added among others
-template <bool DIRECTED, typename IdNodesT, typename InpLinksT>
+template <bool DIRECTED, typename IdNodesT, typename InpLinksT, typename ErrsT>
 bool acsAddNodeLinks(const IdNodesT& idNodes, Id src, InpLinksT&& links
-	, bool sumdups, Reduction reduction, Id rlsmin, StructLinkErrors* errs)
+	, bool sumdups, Reduction reduction, Id rlsmin, ErrsT* errs)
 {
 #if VALIDATE >= 2
 	// Note: initializer links doesn't empty
@@ -465,11 +466,11 @@ bool acsAddNodeLinks(const IdNodesT& idNodes, Id src, InpLinksT&& links
 //! \param sumdups bool  - accumulate weight of duplicated links or just skip them
 //! \param reduction Reduction  - core node links reduction policy
 //! \param rlsmin Id  - minimal number of links after the reduction, 0 means omit the reduction
-//! \param errs StructLinkErrors*  - occurred accumulated link errors to be reported by the caller
+//! \param errs ErrsT*  - occurred accumulated link errors to be reported by the caller
 //! \return bool  - directed links added among others
-template <bool DIRECTED, typename NodesT, typename IdNodesT, typename InpLinksT>
+template <bool DIRECTED, typename NodesT, typename IdNodesT, typename InpLinksT, typename ErrsT>
 bool acsAddNodeAndLinks(NodesT& nodes, IdNodesT& idNodes, Id src, InpLinksT&& links
-	, bool shuffle, bool sumdups, Reduction reduction, Id rlsmin, StructLinkErrors* errs)  // , StructNodeErrors* nderrs
+	, bool shuffle, bool sumdups, Reduction reduction, Id rlsmin, ErrsT* errs)  // , StructNodeErrors* nderrs
 {
 	// Construct & fill nodeIds to be [randomly] instantiated
 	Items<Id>  nodeIds;
@@ -504,6 +505,213 @@ bool acsAddNodeAndLinks(NodesT& nodes, IdNodesT& idNodes, Id src, InpLinksT&& li
 	return directed;
 }
 
+// Parallel links validation --------------------------------------------------
+//! \brief Link of the node to be fixed by the links validation
+//!
+//! \tparam NodeT  - node type
+template <typename NodeT>
+struct NodeLinkFix {
+	NodeT*  node;  //!< Node which links are fixed
+	NodeT*  dest;  //!< Dest node of the fixing link
+	LinkWeight  weight;  //!< Weight of the fixing link
+
+    //! \brief NodeLinkFix constructor
+    //!
+    //! \param nd NodeT*  - node which links are fixed
+    //! \param dst NodeT*  - dest node of the fixing link
+    //! \param lweight LinkWeight  - weight of the fixing link
+	NodeLinkFix(NodeT* nd, NodeT* dst, LinkWeight lweight) noexcept
+	: node(nd), dest(dst), weight(lweight)  {}
+};
+
+//! \brief Make the weighted link
+//!
+//! \tparam LinkT  - link type
+//!
+//! \param dest DestT  - dest of the link (node or id)
+//! \param weight LinkWeight  - weight of the link
+//! \return LinkT  - resulting link
+template <typename LinkT, typename DestT>
+inline enable_if_t<LinkT::IS_WEIGHTED, LinkT> makeLink(DestT dest, LinkWeight weight)
+{ return LinkT(dest, weight); }
+
+//! \copydoc makeLink
+template <typename LinkT, typename DestT>
+inline enable_if_t<!LinkT::IS_WEIGHTED, LinkT> makeLink(DestT dest, LinkWeight)
+{ return LinkT(dest); }
+
+//! \brief Accumulate weight of the duplicated weighted link
+//!
+//! \param ln LinkT&  - link to be updated
+//! \param dup const LinkT&  - duplicate of the link
+//! \return void
+template <typename LinkT>
+inline enable_if_t<LinkT::IS_WEIGHTED> accLinkWeight(LinkT& ln, const LinkT& dup)
+{ ln.weight += dup.weight; }
+
+//! \copydoc accLinkWeight
+template <typename LinkT>
+inline enable_if_t<!LinkT::IS_WEIGHTED> accLinkWeight(LinkT&, const LinkT&)  {}
+
+//! \brief Validate Node's links in parallel, show and FIX errors if exist
+//! \note Parallel counterpart of the validate() for the large networks:
+//! 	- severe: the links of each node are ordered and their duplicates are
+//! 	merged (weights are summed) by the workers independently;
+//! 	- the back link of each link is located by the binary search in the
+//! 	ordered links of the dest node, the nodes are only read by the workers,
+//! 	the missed back links are collected to the worker-local lists;
+//! 	- the missed back links are added sequentially in the order of the nodes
+//! 	and links, so the result does not depend on the number of workers.
+//! \pre If a node A has some link to the node B then node B must have
+//! 	the link to the node A even if link's weight is 0.
+//! 	Links should be ordered by bsDest() unless severe.
+//! \post Links are ordered and unique, the missed back links are added.
+//!
+//! \note
+//! - throws invalid_argument in case of the inconsistent weights of the
+//! 	symmetric links
+//! - the missed back link has the same weight for the symmetric network
+//! 	and zero weight otherwise
+//! - self links are omitted, they should be specified as the node weight
+//!
+//! \tparam NONSYMMETRIC  - inbound/outbound weights of the links are not the same
+//! \tparam NodesT  - random access container of the nodes
+//!
+//! \param nodes NodesT&  - network nodes to be validated
+//! \param weight AccWeight&  - total bidirectional network weight to be updated
+//! 	by the half of the weight of the added back links, see linksWeight()
+//! \param linksNum Size&  - nodes links number to be updated by the added back
+//! 	links and the removed merged duplicates
+//! \param severe bool  - severe validation, order and deduplicate the node links
+//! \param workers=0 unsigned  - max number of workers, 0 means the number of
+//! 	the hardware threads
+//! \return Size  - the number of fixed links: merged duplicates and added back links
+template <bool NONSYMMETRIC, typename NodesT>
+Size validateLinks(NodesT& nodes, AccWeight& weight, Size& linksNum, bool severe
+	, unsigned workers=0)
+{
+	using NodeT = typename NodesT::value_type;
+	using LinkT = typename NodeT::links_type::value_type;
+	using Fixes = vector<NodeLinkFix<NodeT>>;
+
+	// Min number of nodes per worker
+	constexpr size_t  NODES_MIN = 4096;
+	workers = workersNum(nodes.size(), NODES_MIN, workers);
+	vector<Fixes>  dups(workers);  // Merged duplicated links
+	vector<Fixes>  fixes(workers);  // Missed back links
+	vector<Fixes>  mismatches(workers);  // Links having inconsistent back links
+	const auto  inds = nodes.begin();
+
+	if(severe)
+		parallelRanges(nodes.size(), [&](size_t ib, size_t ie, unsigned iw) {
+			for(; ib < ie; ++ib) {
+				auto&  nd = inds[ib];
+				auto&  links = nd.links;
+				if(sorted(links.begin(), links.end(), bsDest<LinkT>, true))
+					continue;
+				sort(links.begin(), links.end(), cmpDest<LinkT>);
+				// Note: the links are non-empty since they are not sorted
+				auto  iln = links.begin();
+				for(auto jln = iln + 1; jln != links.end(); ++jln) {
+					if(jln->dest != iln->dest) {
+						if(++iln != jln)
+							*iln = std::move(*jln);
+						continue;
+					}
+					accLinkWeight(*iln, *jln);
+					dups[iw].emplace_back(&nd, iln->dest, jln->weight);
+				}
+				links.erase(++iln, links.end());
+			}
+		}, workers);
+
+	// Locate the back links, the nodes are not modified here
+	parallelRanges(nodes.size(), [&](size_t ib, size_t ie, unsigned iw) {
+		auto&  wfixes = fixes[iw];
+		for(; ib < ie; ++ib) {
+			auto&  nd = inds[ib];
+#if VALIDATE >= 2
+			assert(sorted(nd.links.begin(), nd.links.end(), bsDest<LinkT>, true)
+				&& "validateLinks(), the node links should be ordered and unique");
+#endif // VALIDATE
+			for(const auto& ln: nd.links) {
+				NodeT* const  dst = ln.dest;
+				if(dst == &nd)
+					continue;
+				const auto&  dlinks = dst->links;
+				const auto  idl = fast_find(dlinks.begin(), dlinks.end(), &nd
+					, bsObjsDest<decltype(nd.links)>);
+				if(idl == dlinks.end())
+					wfixes.emplace_back(dst, &nd, NONSYMMETRIC ? 0 : ln.weight);
+				// Note: each inconsistent pair is reported once, from the lower address
+				else if(!NONSYMMETRIC && LinkT::IS_WEIGHTED && cmpBase(&nd, dst)
+				&& !equal<LinkWeight>(idl->weight, ln.weight))
+					mismatches[iw].emplace_back(&nd, dst, ln.weight);
+			}
+		}
+	}, workers);
+
+	StructLinkErrors  lnerrs("WARNING validateLinks(), the inconsistent weights of the symmetric links: ");
+	size_t  nmms = 0;  // The number of inconsistent links
+	for(const auto& wmms: mismatches) {
+		for(const auto& mm: wmms)
+			lnerrs.add(LinkSrcDstId(mm.node->id, mm.dest->id));
+		nmms += wmms.size();
+	}
+	if(nmms) {
+		lnerrs.show();
+		throw invalid_argument("validateLinks(), the symmetric links have inconsistent weights\n");
+	}
+
+	StructLinkErrors  dperrs("WARNING validateLinks(), the duplicated links are merged: ");
+	Size  ndups = 0;  // The number of merged duplicated links
+	for(const auto& wdups: dups) {
+		for(const auto& dp: wdups)
+			dperrs.add(LinkSrcDstId(dp.node->id, dp.dest->id));
+		ndups += wdups.size();
+	}
+	dperrs.show();
+	linksNum -= ndups;
+
+	// Add the missed back links in the deterministic order: the fixes are
+	// ordered by the source nodes and grouped by the extending nodes
+	Fixes  bfixes;
+	{
+		size_t  nfixes = 0;
+		for(const auto& wfixes: fixes)
+			nfixes += wfixes.size();
+		if(!nfixes)
+			return ndups;
+		bfixes.reserve(nfixes);
+	}
+	for(auto& wfixes: fixes) {
+		bfixes.insert(bfixes.end(), wfixes.begin(), wfixes.end());
+		Fixes().swap(wfixes);
+	}
+	// Note: the order of the same extending node fixes is retained, which is
+	// the order of the source nodes (the order of the nodes in the container)
+	std::stable_sort(bfixes.begin(), bfixes.end()
+		, [](const NodeLinkFix<NodeT>& a, const NodeLinkFix<NodeT>& b) noexcept {
+			return cmpBase(a.node, b.node);
+		});
+	StructLinkErrors  fxerrs("WARNING validateLinks(), the missed back links are added: ");
+	typename NodeT::links_type  run;  // Ordered run of the back links of a node
+	for(auto ifx = bfixes.begin(); ifx != bfixes.end();) {
+		NodeT* const  nd = ifx->node;
+		run.clear();
+		do {
+			run.push_back(makeLink<LinkT>(ifx->dest, ifx->weight));
+			weight += ifx->weight / static_cast<AccWeight>(2);
+			fxerrs.add(LinkSrcDstId(ifx->dest->id, nd->id));
+		} while(++ifx != bfixes.end() && ifx->node == nd);
+		sort(run.begin(), run.end(), cmpDest<LinkT>);
+		insortedRun(nd->links, run.begin(), run.end(), bsDest<LinkT>);
+	}
+	fxerrs.show();
+	linksNum += bfixes.size();
+	return ndups + bfixes.size();
+}
+
 // External Input interfaces implementation -----------------------------------
 template <bool LINKS_WEIGHTED>
 Graph<LINKS_WEIGHTED>::Graph(Id nodesNum, bool shuffle, bool sumdups, Reduction reduction)
@@ -544,6 +752,35 @@ void Graph<LINKS_WEIGHTED>::reset(Id nodesNum, bool shuffle, bool sumdups, Reduc
 	m_sumdups = sumdups;
 }
 
+template <bool LINKS_WEIGHTED>
+Graph<LINKS_WEIGHTED> Graph<LINKS_WEIGHTED>::replica() const
+{
+	Graph  graph(m_dclnds, m_shuffle, m_sumdups);
+	graph.m_directed = m_directed;
+	graph.m_reduction = m_reduction;
+	graph.m_rlsmin = m_rlsmin;
+	graph.m_idNodes.reserve(m_idNodes.size());
+	// Note: the nodes are created in the same order as in the graph, the node
+	// weight is the self weight formed on the links reduction
+	for(const auto& nd: m_nodes) {
+		graph.m_nodes.emplace_back(nd.id);
+		auto&  rnd = graph.m_nodes.back();
+		rnd.addWeight(nd.weight());
+		graph.m_idNodes.emplace(nd.id, &rnd);
+	}
+	// Copy the links remapping their dest nodes to the replicated ones
+	auto  irnd = graph.m_nodes.begin();
+	for(const auto& nd: m_nodes) {
+		auto&  links = (irnd++)->links;
+		links.reserve(nd.links.size());
+		for(const auto& ln: nd.links)
+			links.push_back(makeLink<LinkT>(graph.m_idNodes.at(ln.dest->id), ln.weight));
+		// Note: the links are ordered by the dest addresses, which might have distinct order
+		sort(links.begin(), links.end(), cmpDest<LinkT>);
+	}
+	return graph;
+}
+
 template <bool LINKS_WEIGHTED>
 auto Graph<LINKS_WEIGHTED>::release(IdItems<NodeT>* idnodes, bool* directed)
 //-> unique_ptr<NodesT>
@@ -612,35 +849,35 @@ void Graph<LINKS_WEIGHTED>::addNodes(const initializer_list<Id>& nodesIds, Struc
 }
 
 template <bool LINKS_WEIGHTED>
-template <bool DIRECTED>
+template <bool DIRECTED, typename ErrsT>
 void Graph<LINKS_WEIGHTED>::addNodeLinks(Id node, InpLinksT&& links
-	, StructLinkErrors* lnerrs)
+	, ErrsT* lnerrs)
 {
 	m_directed = acsAddNodeLinks<DIRECTED>(m_idNodes, node, forward<InpLinksT>(links)
 		, m_sumdups, m_reduction, m_rlsmin, lnerrs) || m_directed;
 }
 
 template <bool LINKS_WEIGHTED>
-template <bool DIRECTED>
+template <bool DIRECTED, typename ErrsT>
 void Graph<LINKS_WEIGHTED>::addNodeLinks(Id node, const initializer_list<InpLinkT>& links
-	, StructLinkErrors* lnerrs)
+	, ErrsT* lnerrs)
 {
 	m_directed = acsAddNodeLinks<DIRECTED>(m_idNodes, node, Links<InpLink<LINKS_WEIGHTED>>(links)
 		, m_sumdups, m_reduction, m_rlsmin, lnerrs) || m_directed;
 }
 
 template <bool LINKS_WEIGHTED>
-template <bool DIRECTED>
+template <bool DIRECTED, typename ErrsT>
 void Graph<LINKS_WEIGHTED>::addNodeAndLinks(Id node, InpLinksT&& links
-	, StructLinkErrors* lnerrs)
+	, ErrsT* lnerrs)
 {
 	m_directed = acsAddNodeAndLinks<DIRECTED>(m_nodes, m_idNodes, node, forward<InpLinksT>(links)
 		, m_shuffle, m_sumdups, m_reduction, m_rlsmin, lnerrs) || m_directed;
 }
 
 template <bool LINKS_WEIGHTED>
-template <bool DIRECTED>
-void Graph<LINKS_WEIGHTED>::addLink(Id snode, Id dnode, LinkWeight weight, StructLinkErrors* lnerrs)
+template <bool DIRECTED, typename ErrsT>
+void Graph<LINKS_WEIGHTED>::addLink(Id snode, Id dnode, LinkWeight weight, ErrsT* lnerrs)
 {
 	try {
 		auto snd = m_idNodes.at(snode);
@@ -658,6 +895,79 @@ void Graph<LINKS_WEIGHTED>::addLink(Id snode, Id dnode, LinkWeight weight, Struc
 	}
 }
 
+template <bool LINKS_WEIGHTED>
+template <bool DIRECTED, typename ErrsT>
+void Graph<LINKS_WEIGHTED>::addLinks(const Id* srcs, const Id* dsts, const LinkWeight* weights
+	, size_t num, ErrsT* lnerrs)
+{
+	if(!num)
+		return;
+	if(!srcs || !dsts)
+		throw invalid_argument("addLinks(), the src and dest ids should be specified\n");
+	if(!LINKS_WEIGHTED && weights)
+		throw invalid_argument("addLinks(), weights are not applicable for the unweighted links\n");
+
+	// Order the links by the src ids retaining the input order of each node links
+	bool  grouped = true;  // The links are already ordered by the src ids
+	for(size_t i = 1; i < num && grouped; ++i)
+		grouped = srcs[i - 1] <= srcs[i];
+	vector<size_t>  order;  // Indexes of the links ordered by the src ids
+	if(!grouped) {
+		order.resize(num);
+		for(size_t i = 0; i < num; ++i)
+			order[i] = i;
+		vector<size_t>  buf;
+		radixSort(order, buf, [srcs](size_t i) noexcept { return srcs[i]; });
+	}
+
+	InpLinksT  links;
+	for(size_t ib = 0; ib < num;) {
+		size_t  i = grouped ? ib : order[ib];
+		const Id  sid = srcs[i];
+		do {
+			links.push_back(makeLink<InpLinkT>(dsts[i]
+				, weights ? weights[i] : SimpleLink<LinkWeight>::weight));
+		} while(++ib < num && srcs[i = grouped ? ib : order[ib]] == sid);
+		addNodeAndLinks<DIRECTED>(sid, move(links), lnerrs);
+		links.clear();
+	}
+}
+
+template <bool LINKS_WEIGHTED>
+template <bool DIRECTED, typename ErrsT>
+void Graph<LINKS_WEIGHTED>::addCsrLinks(const Size* indptr, Id nodesNum, const Id* indices
+	, const LinkWeight* weights, ErrsT* lnerrs)
+{
+	if(!nodesNum)
+		return;
+	if(!indptr || (indptr[nodesNum] && !indices))
+		throw invalid_argument("addCsrLinks(), the indptr and indices should be specified\n");
+	if(!LINKS_WEIGHTED && weights)
+		throw invalid_argument("addCsrLinks(), weights are not applicable for the unweighted links\n");
+	for(Id i = 0; i < nodesNum; ++i)
+		if(indptr[i] > indptr[i + 1])
+			throw invalid_argument(string("addCsrLinks(), indptr should be ordered, row #")
+				.append(std::to_string(i)) += '\n');
+	for(Size j = indptr[0]; j < indptr[nodesNum]; ++j)
+		if(indices[j] >= nodesNum)
+			throw invalid_argument(string("addCsrLinks(), indices should be < nodesNum, index #")
+				.append(std::to_string(j)).append(": ").append(std::to_string(indices[j])) += '\n');
+
+	// Note: the nodes are created in the order of ids (or shuffled) to be
+	// independent of the links
+	addNodes(nodesNum);
+	InpLinksT  links;
+	for(Id i = 0; i < nodesNum; ++i) {
+		if(indptr[i] == indptr[i + 1])
+			continue;
+		for(Size j = indptr[i]; j < indptr[i + 1]; ++j)
+			links.push_back(makeLink<InpLinkT>(indices[j]
+				, weights ? weights[j] : SimpleLink<LinkWeight>::weight));
+		addNodeLinks<DIRECTED>(i, move(links), lnerrs);
+		links.clear();
+	}
+}
+
 template <bool LINKS_WEIGHTED>
 auto Graph<LINKS_WEIGHTED>::buildHierarchy(const ClusterOptions& opts) -> Hierarchy<LinksT>&
 {
@@ -0,0 +1,537 @@
+//! \brief Extrinsic accuracy measures of the [overlapping] clusterings:
+//! mean F1, overlapping NMI and Omega index.
+//!
+//! The clusterings are represented by the sorted member arrays of the clusters.
+//! The ground-truth clustering is indexed once by the AccuracyEvaluator, which
+//! scores any number of the evaluating clusterings (levels) without re-parsing.
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#ifndef ACCURACY_HPP
+#define ACCURACY_HPP
+
+#include <cstdint>  // uintX_t
+#include <cmath>  // log2
+#include <vector>
+#include <atomic>
+#include <algorithm>  // sort, unique, lower_bound
+#include <limits>  // numeric_limits
+
+#include "fileio.hpp"
+#include "parallel.hpp"
+
+
+namespace daoc {
+
+using std::vector;
+
+// Type Declarations ---------------------------------------------------
+//! \brief Clusters membership as the sorted member arrays
+//!
+//! \tparam Id  - type of the member ids
+template <typename Id>
+struct Membership {
+	using IdT = Id;  //!< Type of the member ids
+
+	vector<uint64_t>  offsets;  //!< Offsets of the cluster members, clusters() + 1 items
+	vector<Id>  members;  //!< Ordered unique members of each cluster
+
+	//! \brief Default constructor
+	Membership(): offsets(1, 0), members()  {}
+
+	//! \brief The number of clusters
+	//!
+	//! \return size_t  - the number of clusters
+	size_t clusters() const noexcept  { return offsets.size() - 1; }
+
+	//! \brief Begin of the cluster members
+	//!
+	//! \param icl size_t  - cluster index
+	//! \return const Id*  - the first member
+	const Id* begin(size_t icl) const noexcept  { return members.data() + offsets[icl]; }
+
+	//! \brief End of the cluster members
+	//!
+	//! \param icl size_t  - cluster index
+	//! \return const Id*  - past the last member
+	const Id* end(size_t icl) const noexcept  { return members.data() + offsets[icl + 1]; }
+
+	//! \brief The number of the cluster members
+	//!
+	//! \param icl size_t  - cluster index
+	//! \return size_t  - the number of members
+	size_t size(size_t icl) const noexcept  { return offsets[icl + 1] - offsets[icl]; }
+
+	//! \brief Add the cluster ordering and deduplicating its members
+	//! \note Empty clusters are omitted
+	//!
+	//! \param cnds vector<Id>&  - the cluster members, the content is reordered
+	//! \return void
+	void add(vector<Id>& cnds);
+};
+
+//! \brief Load the clusters membership from the CNL or binary CNL (.cnb) file
+//!
+//! \tparam Id  - type of the member ids
+//!
+//! \param file NamedFileWrapper&  - input collection of clusters
+//! \param cmin=0 size_t  - min allowed cluster size
+//! \param cmax=0 size_t  - max allowed cluster size, 0 means any size
+//! \param verbose=true bool  - print the number of loaded clusters to the stdout
+//! \return Membership<Id>  - loaded membership, empty on the invalid input
+template <typename Id>
+Membership<Id> loadMembership(NamedFileWrapper& file, size_t cmin=0, size_t cmax=0
+	, bool verbose=true);
+
+//! Extrinsic accuracy measures
+enum AccuracyFlags: uint8_t {
+	ACC_NONE = 0,
+	ACC_F1 = 1,  //!< Mean F1
+	ACC_ONMI = 2,  //!< Overlapping NMI
+	ACC_OMEGA = 4,  //!< Omega index
+	ACC_ALL = ACC_F1 | ACC_ONMI | ACC_OMEGA
+};
+
+//! Extrinsic accuracy values
+struct Accuracy {
+	uint8_t  flags;  //!< Evaluated measures, AccuracyFlags
+	double  f1gt;  //!< Average of the best-matching F1 of the ground-truth clusters
+	double  f1cl;  //!< Average of the best-matching F1 of the evaluating clusters
+	double  f1;  //!< Mean F1: harmonic mean of f1gt and f1cl
+	double  onmi;  //!< Overlapping NMI, the McDaid's NMI_max variant of the LFK NMI
+	double  omega;  //!< Omega index, the overlapping variant of the Adjusted Rand Index
+
+	//! \brief Default constructor
+	Accuracy() noexcept: flags(ACC_NONE), f1gt(0), f1cl(0), f1(0), onmi(0), omega(0)  {}
+};
+
+//! \brief Evaluator of the extrinsic accuracy measures against the ground-truth
+//! \note The ground-truth is indexed once: the node ids are mapped to the dense
+//! 	indices and the node-to-clusters index is built. The contingency of each
+//! 	evaluating clustering is counted in parallel.
+//!
+//! \tparam Id  - type of the member ids
+template <typename Id>
+class AccuracyEvaluator {
+	//! Node-to-clusters index
+	struct NodeClusters {
+		vector<uint64_t>  offsets;  //!< Offsets of the node clusters, nodes + 1 items
+		vector<Id>  clusters;  //!< Ordered indices of the clusters of each node
+
+		//! \brief Build the index
+		//!
+		//! \param mbs const Membership<Id>&  - membership with the dense member indices
+		//! \param ndsnum size_t  - the number of nodes, > any member index
+		void build(const Membership<Id>& mbs, size_t ndsnum);
+	};
+
+	const unsigned  m_workers;  //!< The number of workers
+	vector<Id>  m_nodes;  //!< Ordered unique ids of the ground-truth nodes
+	Membership<Id>  m_gt;  //!< Ground-truth membership with the dense member indices
+	NodeClusters  m_gtidx;  //!< Ground-truth node-to-clusters index
+public:
+	//! \brief Constructor
+	//!
+	//! \param gt const Membership<Id>&  - ground-truth clustering
+	//! \param workers=0 unsigned  - max number of workers, 0 means the number of
+	//! 	the hardware threads
+	explicit AccuracyEvaluator(const Membership<Id>& gt, unsigned workers=0);
+
+	//! \brief The number of the ground-truth clusters
+	//!
+	//! \return size_t  - the number of clusters
+	size_t clusters() const noexcept  { return m_gt.clusters(); }
+
+	//! \brief Evaluate accuracy of the clustering against the ground-truth
+	//! \note The node base is the union of the ground-truth and evaluating nodes
+	//!
+	//! \param cls const Membership<Id>&  - evaluating clustering
+	//! \param flags=ACC_ALL uint8_t  - evaluating measures, AccuracyFlags
+	//! \return Accuracy  - resulting measures
+	Accuracy evaluate(const Membership<Id>& cls, uint8_t flags=ACC_ALL) const;
+protected:
+	//! \brief Match the clusters of xs to the clusters of ys by the contingency counting
+	//!
+	//! \param xs const Membership<Id>&  - matching clusters
+	//! \param ys const Membership<Id>&  - matched clusters
+	//! \param yidx const NodeClusters&  - node-to-clusters index of ys
+	//! \param ndsnum size_t  - the number of nodes in the node base
+	//! \param f1s vector<double>*  - best-matching F1 of each cluster of xs if not nullptr
+	//! \param cents vector<double>*  - conditional entropy H(X_k|Y) of each cluster
+	//! 	of xs by the LFK constraint if not nullptr
+	void match(const Membership<Id>& xs, const Membership<Id>& ys, const NodeClusters& yidx
+		, size_t ndsnum, vector<double>* f1s, vector<double>* cents) const;
+
+	//! \brief Omega index of two clusterings
+	//!
+	//! \param xs const Membership<Id>&  - first clustering
+	//! \param xidx const NodeClusters&  - node-to-clusters index of xs
+	//! \param ys const Membership<Id>&  - second clustering
+	//! \param yidx const NodeClusters&  - node-to-clusters index of ys
+	//! \param ndsnum size_t  - the number of nodes in the node base
+	//! \return double  - Omega index
+	double omega(const Membership<Id>& xs, const NodeClusters& xidx
+		, const Membership<Id>& ys, const NodeClusters& yidx, size_t ndsnum) const;
+
+	//! \brief Process the items in parallel by the dynamically fetched chunks
+	//! \note Balances the skewed workload, e.g. the clusters of distinct sizes
+	//!
+	//! \tparam ProcF  - processing function: void (size_t ib, size_t ie, unsigned iw)
+	//!
+	//! \param size size_t  - the number of items
+	//! \param proc ProcF&&  - processing function
+	//! \param workers unsigned  - the number of workers
+	template <typename ProcF>
+	static void parallelChunks(size_t size, ProcF&& proc, unsigned workers);
+
+	//! \brief Entropy term of the binary variable
+	//!
+	//! \param w double  - the number of items having the value
+	//! \param n double  - the total number of items
+	//! \return double  - entropy term
+	static double entropy(double w, double n) noexcept
+		{ return w > 0 ? -w * log2(w / n) : 0; }
+};
+
+// Template Definitions ------------------------------------------------
+template <typename Id>
+void Membership<Id>::add(vector<Id>& cnds)
+{
+	if(cnds.empty())
+		return;
+	std::sort(cnds.begin(), cnds.end());
+	members.insert(members.end(), cnds.begin(), std::unique(cnds.begin(), cnds.end()));
+	offsets.push_back(members.size());
+}
+
+template <typename Id>
+Membership<Id> loadMembership(NamedFileWrapper& file, size_t cmin, size_t cmax, bool verbose)
+{
+	Membership<Id>  mbs;  // Note: returned using NRVO optimization
+
+	if(!file)
+		return mbs;
+
+	// Load the binary membership if the signature is present
+	vector<Id>  cnds;  // Cluster nodes
+	if(isCnbInput(file)) {
+		CnbHeader  hdr;
+		vector<uint64_t>  offsets;  // Offsets of the cluster members
+		vector<uint32_t>  members;  // Member node ids
+		if(!loadCnb(file, hdr, offsets, members))
+			return mbs;
+		mbs.offsets.reserve(offsets.size());
+		mbs.members.reserve(members.size());
+		for(size_t icl = 0; icl < hdr.clsnum; ++icl) {
+			const size_t  csize = offsets[icl + 1] - offsets[icl];
+			// Filter the cluster by size
+			if(csize < cmin || (cmax && csize > cmax))
+				continue;
+			cnds.assign(members.begin() + offsets[icl], members.begin() + offsets[icl + 1]);
+			mbs.add(cnds);
+		}
+	} else {
+		// Note: CNL [CSN] format is supported for the textual input
+		const string  text = loadCnlBody(file, verbose);
+		const unsigned  workers = workersNum(text.size(), 1 << 20);
+		const auto  bounds = lineChunks(text, workers);
+		vector<CnlChunk<Id>>  chunks(workers);
+		parallelRanges(workers, [&](size_t ic, size_t, unsigned) {
+			parseCnlChunk(text.data() + bounds[ic], text.data() + bounds[ic + 1], chunks[ic]
+				, cmin, cmax, true);
+		}, workers);
+		for(const auto& chunk: chunks)
+			for(size_t icl = 0; icl + 1 < chunk.offsets.size(); ++icl) {
+				cnds.assign(chunk.members.begin() + chunk.offsets[icl]
+					, chunk.members.begin() + chunk.offsets[icl + 1]);
+				mbs.add(cnds);
+			}
+	}
+	if(verbose)
+		printf("loadMembership(), clusters loaded: %lu, members: %lu\n"
+			, mbs.clusters(), mbs.members.size());
+
+	return mbs;
+}
+
+template <typename Id>
+void AccuracyEvaluator<Id>::NodeClusters::build(const Membership<Id>& mbs, size_t ndsnum)
+{
+	// Counting sort of the (node, cluster) pairs by the node
+	offsets.assign(ndsnum + 1, 0);
+	for(auto nd: mbs.members)
+		++offsets[nd + 1];
+	for(size_t i = 1; i <= ndsnum; ++i)
+		offsets[i] += offsets[i - 1];
+	clusters.resize(mbs.members.size());
+	vector<uint64_t>  pos(offsets.begin(), offsets.end() - 1);
+	// Note: the clusters of each node are ordered since the clusters are traversed in order
+	for(size_t icl = 0; icl < mbs.clusters(); ++icl)
+		for(auto im = mbs.begin(icl); im != mbs.end(icl); ++im)
+			clusters[pos[*im]++] = icl;
+}
+
+template <typename Id>
+template <typename ProcF>
+void AccuracyEvaluator<Id>::parallelChunks(size_t size, ProcF&& proc, unsigned workers)
+{
+	constexpr size_t  chunk = 64;  // The number of items fetched at once
+	workers = workersNum(size, 2 * chunk, workers);
+	std::atomic<size_t>  inext(0);  // The next chunk
+	parallelRanges(workers, [&](size_t iw, size_t, unsigned) {
+		for(size_t ib = inext.fetch_add(chunk); ib < size; ib = inext.fetch_add(chunk))
+			proc(ib, std::min(ib + chunk, size), iw);
+	}, workers);
+}
+
+template <typename Id>
+AccuracyEvaluator<Id>::AccuracyEvaluator(const Membership<Id>& gt, unsigned workers)
+: m_workers(workersNum(numeric_limits<unsigned>::max(), 1, workers)), m_nodes(gt.members)
+, m_gt(), m_gtidx()
+{
+	std::sort(m_nodes.begin(), m_nodes.end());
+	m_nodes.erase(std::unique(m_nodes.begin(), m_nodes.end()), m_nodes.end());
+	// Map the member ids to the dense indices preserving the order of the members
+	m_gt.offsets = gt.offsets;
+	m_gt.members.resize(gt.members.size());
+	parallelRanges(gt.members.size(), [&](size_t ib, size_t ie, unsigned) {
+		for(; ib < ie; ++ib)
+			m_gt.members[ib] = std::lower_bound(m_nodes.begin(), m_nodes.end()
+				, gt.members[ib]) - m_nodes.begin();
+	}, workersNum(gt.members.size(), 1 << 16, m_workers));
+	m_gtidx.build(m_gt, m_nodes.size());
+}
+
+template <typename Id>
+Accuracy AccuracyEvaluator<Id>::evaluate(const Membership<Id>& cls, uint8_t flags) const
+{
+	Accuracy  acc;
+	acc.flags = flags & ACC_ALL;
+	if(!cls.clusters() || !m_gt.clusters() || !acc.flags)
+		return acc;
+
+	// Map the member ids to the dense indices, the nodes missed in the ground-truth
+	// are indexed after the ground-truth nodes
+	vector<Id>  extras;  // Ordered unique ids of the nodes missed in the ground-truth
+	for(auto nid: cls.members)
+		if(!std::binary_search(m_nodes.begin(), m_nodes.end(), nid))
+			extras.push_back(nid);
+	std::sort(extras.begin(), extras.end());
+	extras.erase(std::unique(extras.begin(), extras.end()), extras.end());
+	const size_t  ndsnum = m_nodes.size() + extras.size();
+
+	Membership<Id>  dcl;  // Evaluating membership with the dense member indices
+	dcl.offsets = cls.offsets;
+	dcl.members.resize(cls.members.size());
+	parallelChunks(cls.clusters(), [&](size_t ib, size_t ie, unsigned) {
+		for(; ib < ie; ++ib) {
+			const auto  mb = dcl.members.begin() + cls.offsets[ib];
+			auto  im = mb;
+			for(auto it = cls.begin(ib); it != cls.end(ib); ++it, ++im) {
+				auto  ind = std::lower_bound(m_nodes.begin(), m_nodes.end(), *it);
+				*im = ind != m_nodes.end() && *ind == *it ? ind - m_nodes.begin()
+					: m_nodes.size() + (std::lower_bound(extras.begin(), extras.end(), *it)
+						- extras.begin());
+			}
+			// Note: the extra nodes break the order
+			if(!extras.empty())
+				std::sort(mb, im);
+		}
+	}, m_workers);
+	NodeClusters  clidx;
+	clidx.build(dcl, ndsnum);
+
+	// Sum of the per-cluster values
+	auto sum = [this](const vector<double>& vals) {
+		return parallelReduce<double>(vals.size(), [&vals](size_t ib, size_t ie) {
+			double  res = 0;
+			for(; ib < ie; ++ib)
+				res += vals[ib];
+			return res;
+		}, workersNum(vals.size(), 1024, m_workers));
+	};
+
+	if(acc.flags & (ACC_F1 | ACC_ONMI)) {
+		vector<double>  f1gt, f1cl;  // Best-matching F1 of the clusters
+		vector<double>  cegt, cecl;  // Conditional entropies of the clusters
+		const bool  f1 = acc.flags & ACC_F1;
+		const bool  onmi = acc.flags & ACC_ONMI;
+		match(m_gt, dcl, clidx, ndsnum, f1 ? &f1gt : nullptr, onmi ? &cegt : nullptr);
+		match(dcl, m_gt, m_gtidx, ndsnum, f1 ? &f1cl : nullptr, onmi ? &cecl : nullptr);
+		if(f1) {
+			acc.f1gt = sum(f1gt) / f1gt.size();
+			acc.f1cl = sum(f1cl) / f1cl.size();
+			if(acc.f1gt + acc.f1cl > 0)
+				acc.f1 = 2 * acc.f1gt * acc.f1cl / (acc.f1gt + acc.f1cl);
+		}
+		if(onmi) {
+			// Entropies of the clusterings: H(X) = sum_k H(X_k)
+			auto clsent = [ndsnum](const Membership<Id>& mbs) {
+				vector<double>  ents(mbs.clusters());
+				for(size_t i = 0; i < ents.size(); ++i)
+					ents[i] = entropy(mbs.size(i), ndsnum) + entropy(ndsnum - mbs.size(i), ndsnum);
+				return ents;
+			};
+			const double  hgt = sum(clsent(m_gt));
+			const double  hcl = sum(clsent(dcl));
+			const double  hmax = std::max(hgt, hcl);
+			// NMI_max = 0.5 * (H(X) - H(X|Y) + H(Y) - H(Y|X)) / max(H(X), H(Y))
+			acc.onmi = hmax > 0 ? 0.5 * (hgt - sum(cegt) + hcl - sum(cecl)) / hmax : 1;
+		}
+	}
+	if(acc.flags & ACC_OMEGA)
+		acc.omega = omega(m_gt, m_gtidx, dcl, clidx, ndsnum);
+
+	return acc;
+}
+
+template <typename Id>
+void AccuracyEvaluator<Id>::match(const Membership<Id>& xs, const Membership<Id>& ys
+	, const NodeClusters& yidx, size_t ndsnum, vector<double>* f1s, vector<double>* cents) const
+{
+	if(f1s)
+		f1s->assign(xs.clusters(), 0);
+	if(cents)
+		cents->assign(xs.clusters(), 0);
+	const unsigned  workers = workersNum(xs.clusters(), 128, m_workers);
+	// Per-worker contingency counters of the ys clusters
+	vector<vector<Id>>  counts(workers);
+	parallelChunks(xs.clusters(), [&](size_t ib, size_t ie, unsigned iw) {
+		auto&  cnts = counts[iw];
+		if(cnts.empty())
+			cnts.resize(ys.clusters());
+		vector<Id>  touched;  // Indices of the ys clusters having the common members
+		const size_t  yndsnum = yidx.offsets.size() - 1;
+		const double  n = ndsnum;
+		for(; ib < ie; ++ib) {
+			for(auto im = xs.begin(ib); im != xs.end(ib); ++im) {
+				if(*im >= yndsnum)
+					continue;
+				for(auto ic = yidx.offsets[*im]; ic < yidx.offsets[*im + 1]; ++ic)
+					if(!cnts[yidx.clusters[ic]]++)
+						touched.push_back(yidx.clusters[ic]);
+			}
+			const double  xsize = xs.size(ib);
+			double  f1max = 0;
+			// H(X_k), which is the upper bound of H(X_k|Y_l)
+			const double  hx = entropy(xsize, n) + entropy(n - xsize, n);
+			double  cemin = hx;
+			for(auto icl: touched) {
+				const double  d = cnts[icl];  // X_k=1, Y_l=1
+				cnts[icl] = 0;
+				const double  ysize = ys.size(icl);
+				f1max = std::max(f1max, 2 * d / (xsize + ysize));
+				if(!cents)
+					continue;
+				const double  a = n - xsize - ysize + d;  // X_k=0, Y_l=0
+				const double  b = ysize - d;  // X_k=0, Y_l=1
+				const double  c = xsize - d;  // X_k=1, Y_l=0
+				const double  had = entropy(a, n) + entropy(d, n);
+				const double  hbc = entropy(b, n) + entropy(c, n);
+				// LFK constraint: Y_l is considered only if it is closer to X_k than to its complement
+				if(had >= hbc)
+					cemin = std::min(cemin, had + hbc - entropy(b + d, n) - entropy(a + c, n));
+			}
+			touched.clear();
+			if(f1s)
+				(*f1s)[ib] = f1max;
+			if(cents)
+				(*cents)[ib] = cemin;
+		}
+	}, workers);
+}
+
+template <typename Id>
+double AccuracyEvaluator<Id>::omega(const Membership<Id>& xs, const NodeClusters& xidx
+	, const Membership<Id>& ys, const NodeClusters& yidx, size_t ndsnum) const
+{
+	if(ndsnum < 2)
+		return 1;
+	const unsigned  workers = workersNum(ndsnum, 256, m_workers);
+	//! Per-worker pairs counting
+	struct Tally {
+		vector<uint64_t>  xhist;  //!< The number of pairs by the co-occurrence in xs
+		vector<uint64_t>  yhist;  //!< The number of pairs by the co-occurrence in ys
+		uint64_t  agreed = 0;  //!< The number of pairs with the same co-occurrence
+		vector<uint32_t>  xcnt;  //!< Co-occurrences of the paired nodes in xs
+		vector<uint32_t>  ycnt;  //!< Co-occurrences of the paired nodes in ys
+	};
+	vector<Tally>  tallies(workers);
+	// Each pair (u, v), u < v is counted on u
+	parallelChunks(ndsnum, [&](size_t ib, size_t ie, unsigned iw) {
+		auto&  tl = tallies[iw];
+		if(tl.xcnt.empty()) {
+			tl.xcnt.resize(ndsnum);
+			tl.ycnt.resize(ndsnum);
+			tl.xhist.resize(1);
+			tl.yhist.resize(1);
+		}
+		vector<Id>  touched;  // Nodes co-occurring with u
+		//! Count the co-occurrences of u with the following nodes
+		auto count = [&touched, &tl](Id u, const Membership<Id>& mbs, const NodeClusters& idx
+		, vector<uint32_t>& cnt, const vector<uint32_t>& cntalt) {
+			if(u + 1u >= idx.offsets.size())
+				return;
+			for(auto ic = idx.offsets[u]; ic < idx.offsets[u + 1]; ++ic) {
+				const auto  icl = idx.clusters[ic];
+				for(auto iv = std::upper_bound(mbs.begin(icl), mbs.end(icl), u); iv != mbs.end(icl); ++iv)
+					if(!cnt[*iv]++ && !cntalt[*iv])
+						touched.push_back(*iv);
+			}
+		};
+		for(; ib < ie; ++ib) {
+			count(ib, xs, xidx, tl.xcnt, tl.ycnt);
+			count(ib, ys, yidx, tl.ycnt, tl.xcnt);
+			for(auto v: touched) {
+				const auto  tx = tl.xcnt[v];
+				const auto  ty = tl.ycnt[v];
+				if(tx >= tl.xhist.size())
+					tl.xhist.resize(tx + 1);
+				if(ty >= tl.yhist.size())
+					tl.yhist.resize(ty + 1);
+				++tl.xhist[tx];
+				++tl.yhist[ty];
+				tl.agreed += tx == ty;
+				tl.xcnt[v] = tl.ycnt[v] = 0;
+			}
+			// Pairs not co-occurring in any cluster
+			const uint64_t  zeros = ndsnum - 1 - ib - touched.size();
+			tl.xhist[0] += zeros;
+			tl.yhist[0] += zeros;
+			tl.agreed += zeros;
+			touched.clear();
+		}
+	}, workers);
+
+	// Merge the integral tallies, which is deterministic
+	vector<uint64_t>  xhist, yhist;
+	uint64_t  agreed = 0;
+	for(const auto& tl: tallies) {
+		if(tl.xhist.size() > xhist.size())
+			xhist.resize(tl.xhist.size());
+		if(tl.yhist.size() > yhist.size())
+			yhist.resize(tl.yhist.size());
+		for(size_t i = 0; i < tl.xhist.size(); ++i)
+			xhist[i] += tl.xhist[i];
+		for(size_t i = 0; i < tl.yhist.size(); ++i)
+			yhist[i] += tl.yhist[i];
+		agreed += tl.agreed;
+	}
+	const double  pairs = double(ndsnum) * (ndsnum - 1) / 2;
+	const double  obs = agreed / pairs;  // Observed agreement
+	double  exp = 0;  // Expected agreement
+	for(size_t i = 0; i < std::min(xhist.size(), yhist.size()); ++i)
+		exp += double(xhist[i]) * yhist[i];
+	exp /= pairs * pairs;
+	return exp < 1 ? (obs - exp) / (1 - exp) : 1;
+}
+
+}  // daoc
+
+#endif // ACCURACY_HPP
@@ -19,6 +19,10 @@
 #include <type_traits>  // is_integral
 #include <limits>  // numeric_limits
 #include <stdexcept> // numeric_limits
+#include <algorithm>  // max
+#if __cplusplus >= 201703L
+#include <string_view>  // Allocation-free hashing of the raw bytes
+#endif // __cplusplus
 
 
 namespace daoc {
@@ -70,6 +74,29 @@ public:
 	//! \return void
 	void add(Id id) noexcept;
 
+	//! \brief Add the batch of ids to the aggregation
+	//! \note The overflow is validated once for the whole batch, so the accumulation
+	//! 	is branchless and vectorized by the compiler. The result is the same as
+	//! 	on the sequential add() of each id
+	//!
+	//! \param ids const Id*  - ids to be included into the hash
+	//! \param num size_t  - the number of ids
+	//! \return void
+	void add(const Id* ids, size_t num) noexcept;
+
+	//! \brief Merge the aggregation, e.g. the partial hash evaluated by another thread
+	//! \note The merged hash is the same as the hash of all ids aggregated sequentially
+	//!
+	//! \param ah const AggHash&  - merging aggregation
+	//! \return AggHash&  - the updated aggregation
+	AggHash& operator +=(const AggHash& ah) noexcept;
+
+	//! \brief Merged aggregation
+	//!
+	//! \param ah const AggHash&  - merging aggregation
+	//! \return AggHash  - resulting aggregation
+	AggHash operator +(const AggHash& ah) const noexcept  { return AggHash(*this) += ah; }
+
 	//! \brief Clear/reset the aggregation
 	//!
 	//! \return void
@@ -96,6 +123,7 @@ public:
 //	bool empty() const noexcept  { return !m_size; }
 
 	//! \brief Evaluate hash of the aggregation
+	//! \note The raw bytes are hashed without the allocation since C++17
 	//!
 	//! \return size_t  - resulting hash
 	size_t hash() const;
@@ -152,6 +180,39 @@ void AggHash<Id, AccId>::add(Id id) noexcept
 	m_id2sum += id * id;
 }
 
+template <typename Id, typename AccId>
+void AggHash<Id, AccId>::add(const Id* ids, size_t num) noexcept
+{
+	Id  idmax = 0;  // Max id to validate the overflow
+	// Note: the local accumulators are independent of the memory of this, which
+	// enables the vectorization
+	AccId  idsum = 0;
+	AccId  id2sum = 0;
+	for(size_t i = 0; i < num; ++i) {
+		idmax = std::max(idmax, ids[i]);
+		const Id  id = ids[i] + idcor;  // Note: the same correction and squaring as in add(id)
+		idsum += id;
+		id2sum += id * id;
+	}
+	// Check for the overflow after the correction
+    // Note: the exception will crash the whole app since noexcept is used but it is fine
+	if(num && Id(idmax + idcor) < idcor)
+		throw domain_error(string("The corrected value of ").append(std::to_string(idmax))
+			.append(" is too large and causes the overflow\n"));
+	m_size += num;
+	m_idsum += idsum;
+	m_id2sum += id2sum;
+}
+
+template <typename Id, typename AccId>
+AggHash<Id, AccId>& AggHash<Id, AccId>::operator +=(const AggHash& ah) noexcept
+{
+	m_size += ah.m_size;
+	m_idsum += ah.m_idsum;
+	m_id2sum += ah.m_id2sum;
+	return *this;
+}
+
 template <typename Id, typename AccId>
 void AggHash<Id, AccId>::clear() noexcept
 {
@@ -164,7 +225,12 @@ template <typename Id, typename AccId>
 size_t AggHash<Id, AccId>::hash() const
 {
 	// ATTENTION: requires filling with zero memory alignment trash or avoid the padding
+	// Note: the hash of string_view is the same as of the string with the same content
+#if __cplusplus >= 201703L
+	return std::hash<std::string_view>()(std::string_view(reinterpret_cast<const char*>(this), sizeof *this));
+#else
 	return std::hash<string>()(string(reinterpret_cast<const char*>(this), sizeof *this));
+#endif // __cplusplus
 }
 
 template <typename Id, typename AccId>
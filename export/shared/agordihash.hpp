@@ -49,6 +49,7 @@
 #include <vector>
 #include <stdexcept>  // logic_error
 #include <limits>  // numeric_limits
+#include <algorithm>  // max, min
 
 #include "arithmetic.hpp"  // csum, square, VALIDATE
 
@@ -60,12 +61,12 @@ using std::array;
 using std::vector;
 using std::numeric_limits;
 using std::logic_error;  // Note implemented
-#if VALIDATE >= 1
+using std::integral_constant;
+// Note: the overflow is validated for CORVLD regardless of VALIDATE
 using std::overflow_error;
+#if VALIDATE >= 1
 using std::domain_error;
-#if VALIDATE >= 2
 using std::underflow_error;
-#endif // VALIDATE 2
 #endif // VALIDATE
 
 
@@ -254,12 +255,29 @@ public:
 	AgordiHash& operator +=(const AgordiHash& other) noexcept  { add(other); return *this; }
 
     //! \brief Add number of items to the hashing
+    //! \note Performed in O(log num) by doubling of the single item hash, the
+    //! 	result is the same as on num calls of add(v)
     //!
     //! \param v UInt  - the item value
     //! \param num Size  - the number of items to be included to the hashing
     //! \return void
 	void add(UInt v, Size num) noexcept;
 
+    //! \brief Add the range of items to the hashing
+    //! \note The contiguous range of 32-bit items is accumulated by the branchless
+    //! 	vectorizable kernel and then added as a hash chunk. The result is the same
+    //! 	as on add(v) of each item
+    //!
+    //! \tparam IterT  - iterator of the UInt items
+    //!
+    //! \param begin IterT  - begin of the range
+    //! \param end IterT  - end of the range
+    //! \return void
+	template <typename IterT, enable_if_t<!is_integral<IterT>::value, bool> = true>
+	void add(IterT begin, IterT end) noexcept
+		{ addRange(begin, end, integral_constant<bool, std::is_convertible<IterT, const UInt*>::value
+			&& sizeof(UInt) == sizeof(uint32_t)>()); }
+
 
     //! \brief Subtract item from the hashing
     //!
@@ -282,6 +300,7 @@ public:
 	AgordiHash& operator -=(const AgordiHash& other) noexcept  { sub(other); return *this; };
 
     //! \brief Subtract number of items from the hashing
+    //! \note Performed in O(log num) by doubling of the single item hash
     //!
     //! \param v UInt  - the item value
     //! \param num Size  - the number of items to be excluded from the hashing
@@ -365,12 +384,14 @@ public:
 	size_t operator()() const noexcept;
 
     //! \brief Encrypted representation
-    //! \note The encrypted version is still collision-free but becomes not iterative
+    //! \note The encrypted version is still collision-free but becomes not iterative.
+    //! 	The encryption is a bijective non-linear mixing of the internal data
+    //! 	zero-padded to the multiple of 8 bytes, which is not a standard cipher
     //!
     //! \return Data  - raw storage the encrypted version of the internal data
 	Data encrypted() const;
 
-    //! \brief Encrypted (cryptographic) digest
+    //! \brief Encrypted digest
     //! \attention The digest is not collision free unlike the AgordiHash itself
     //!
     //! \return size_t  - encrypted hash digest
@@ -412,6 +433,57 @@ public:
     //! \param other const AgordiHash&  - comparing object
     //! \return bool operator  - result of the comparison
 	bool operator !=(const AgordiHash& other) const noexcept  { return !(*this == other); }
+protected:
+    //! \brief Add the contiguous range of 32-bit items by the vectorizable kernel
+    //!
+    //! \param begin const UInt*  - begin of the range
+    //! \param end const UInt*  - end of the range
+    //! \return void
+	void addRange(const UInt* begin, const UInt* end, std::true_type) noexcept;
+
+    //! \brief Add the range of items one by one
+    //!
+    //! \tparam IterT  - iterator of the UInt items
+    //!
+    //! \param begin IterT  - begin of the range
+    //! \param end IterT  - end of the range
+    //! \return void
+	template <typename IterT>
+	void addRange(IterT begin, IterT end, std::false_type) noexcept
+		{ for(; begin != end; ++begin) add(static_cast<UInt>(*begin)); }
+
+    //! \brief Hash of num items v
+    //!
+    //! \param v UInt  - the item value
+    //! \param num Size  - the number of items, > 0
+    //! \return AgordiHash  - resulting hash
+	static AgordiHash multiple(UInt v, Size num) noexcept;
+
+#ifdef UTEST  // Allow the encryption validation in the unit tests
+public:
+#endif // UTEST
+    //! \brief Size of the encrypted data, the hash size is zero-padded to the 8-byte windows
+    //!
+    //! \return size_t  - the number of bytes in the encrypted data
+	constexpr static size_t encSize() noexcept
+		{ return (sizeof(AgordiHash) + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t); }
+
+    //! \brief Encrypt the data in place by the bijective non-linear mixing
+    //! 	of the 8-byte windows in the forward and backward directions
+    //! \pre size is a positive multiple of 8
+    //!
+    //! \param data uint8_t*  - the data to be encrypted
+    //! \param size size_t  - the number of bytes in the data
+    //! \return void
+	static void encrypt(uint8_t* data, size_t size) noexcept;
+
+    //! \brief Decrypt the data in place, the inverse of encrypt()
+    //! \pre size is a positive multiple of 8
+    //!
+    //! \param data uint8_t*  - the data to be decrypted
+    //! \param size size_t  - the number of bytes in the data
+    //! \return void
+	static void decrypt(uint8_t* data, size_t size) noexcept;
 };
 
 // Routines Definitions --------------------------------------------------------
@@ -501,14 +573,96 @@ void AgordiHash<UInt, Size, CORR>::add(const AgordiHash& other) noexcept
 	}
 }
 
+template <typename UInt, typename Size, HashItemCorr CORR>
+auto AgordiHash<UInt, Size, CORR>::multiple(UInt v, Size num) noexcept -> AgordiHash
+{
+	// Note: the single item hash considers the correction and the zero substitution,
+	// the hash of the sum of items is the sum of the item hashes, so the result is
+	// formed by the doubling in O(log num)
+	AgordiHash  item;  // Hash of 2^i items v
+	item.add(v);
+	// Note: the hash of the item can be empty only for the zero item without the correction
+	if(item.empty())
+		return item;
+	AgordiHash  res;
+	// Note: the non-empty item hash should be added to not trigger the zero substitution
+	// of the empty hash chunk
+	bool  empty = true;  // Whether the res is empty
+	for(;;) {
+		if(num & 1) {
+			if(empty) {
+				res = item;
+				empty = false;
+			} else res.add(item);
+		}
+		num >>= 1;
+		if(!num)
+			break;
+		// Note: the copy is required since add() reads the operand after the update
+		const AgordiHash  chunk(item);
+		item.add(chunk);
+	}
+	return res;
+}
+
 template <typename UInt, typename Size, HashItemCorr CORR>
 void AgordiHash<UInt, Size, CORR>::add(UInt v, Size num) noexcept
 {
-	// Note: use Karatsuba algorithm, see:
-	// https://github.com/indy256/codelibrary/blob/master/cpp/bigint.cpp#L338
-	// https://github.com/sercantutar/infint/blob/master/InfInt.h#L653
-	// https://github.com/technophilis/BigIntegerCPP/blob/master/BigInteger.cpp#L97
-	throw logic_error("add() num is not implemented\n");
+	if(num)
+		add(multiple(v, num));
+}
+
+template <typename UInt, typename Size, HashItemCorr CORR>
+void AgordiHash<UInt, Size, CORR>::addRange(const UInt* begin, const UInt* end, std::true_type) noexcept
+{
+	static_assert(sizeof(UInt) == sizeof(uint32_t), "addRange(), 32-bit items are expected");
+	// Note: the block is limited to keep the wide accumulators from the overflow
+	constexpr size_t  blockMax = numeric_limits<uint32_t>::max();
+	while(begin != end) {
+		const size_t  num = std::min<size_t>(end - begin, blockMax);
+		// Accumulate the block with the local wide accumulators
+		uint64_t  vsum = 0;  // Sum of the corrected items
+		uint64_t  sqlow = 0;  // Sum of the low halves of the item squares
+		uint64_t  sqhigh = 0;  // Sum of the high halves of the item squares
+		UInt  vmax = 0;  // Max item to validate the correction overflow
+#if VALIDATE >= 2
+		UInt  vmin = numeric_limits<UInt>::max();  // Min item to validate the zero values
+#endif // VALIDATE
+		for(size_t i = 0; i < num; ++i) {
+			UInt  v = begin[i];
+			vmax = std::max(vmax, v);
+#if VALIDATE >= 2
+			vmin = std::min(vmin, v);
+#endif // VALIDATE
+			if(matches(CORR, HashItemCorr::MASK_CORALL))
+				v += corval;
+			const uint64_t  sq = static_cast<uint64_t>(v) * v;
+			vsum += v;
+			// Note: the zero substitution extends the square of the zero value
+			sqlow += CORR == HashItemCorr::COR0 && !v ? uint64_t(zsval) : sq & 0xFFFFFFFFu;
+			sqhigh += sq >> 32;
+		}
+		begin += num;
+#if VALIDATE >= 2
+		if(!matches(CORR, HashItemCorr::MASK_CORANY) && !vmin)
+			throw domain_error("add() range, 0 value is prohibited in the input\n");
+#endif // VALIDATE
+		if(CORR == HashItemCorr::CORVLD && UInt(vmax + corval) < corval)
+			throw overflow_error("add() range, the corrected value of " + std::to_string(vmax)
+				+ " is too large and causes the overflow\n");
+
+		// Form the hash chunk of the block: sum = hsum:lsum, sum of squares = hv2sum:lv2sum
+		AgordiHash  chunk;
+		chunk.m_lsum = vsum;
+		chunk.m_hsum = vsum >> 32;
+		// Sum of squares = sqhigh * 2^32 + sqlow, which takes up to 96 bits
+		uint64_t  sqsum = sqlow;
+		const bool  carry = csum(sqsum, sqhigh << 32);
+		chunk.m_lv2sum = AccUInt(static_cast<UInt>(sqsum >> 32), static_cast<UInt>(sqsum));
+		chunk.m_hv2sum = (sqhigh >> 32) + carry;
+		if(!chunk.empty())
+			add(chunk);
+	}
 }
 
 template <typename UInt, typename Size, HashItemCorr CORR>
@@ -518,36 +672,69 @@ void AgordiHash<UInt, Size, CORR>::sub(UInt v) noexcept
 	if(empty())
 		throw underflow_error("sub(), subtraction from the empty hash\n");
 #endif // VALIDATE
-	throw logic_error("sub() is not implemented\n");
-////	--m_size;
-//	m_hsum -= sub(m_lsum, v)
-//	m_hv2sum -= sub(m_lv2sum, square(v));
+	// Correct value in the same way as on the addition
+	if(matches(CORR, HashItemCorr::MASK_CORALL)) {  // CORALL, CORVLD
+		v += corval;
+		// Check for the overflow
+		if(CORR == HashItemCorr::CORVLD && v < corval)
+			throw overflow_error("sub(), the corrected value of " + std::to_string(v-corval)
+				+ " is too large and causes the overflow\n");
+	}
+
+#if VALIDATE >= 2
+	const Size  hsum = m_hsum;
+	const Size  hv2sum = m_hv2sum;
+#endif // VALIDATE
+	m_hsum -= csub(m_lsum, v);
+	m_hv2sum -= csub(m_lv2sum, square(v));
+	if(CORR == HashItemCorr::COR0 && !v)
+		m_hv2sum -= csub(m_lv2sum, zsval);  // Zero substitution
+#if VALIDATE >= 2
+	// Note: the high parts are never increased by the subtraction of the item being hashed
+	if(m_hsum > hsum || m_hv2sum > hv2sum)
+		throw underflow_error("sub(), the item was not hashed\n");
+#endif // VALIDATE
 }
 
 template <typename UInt, typename Size, HashItemCorr CORR>
 void AgordiHash<UInt, Size, CORR>::sub(const AgordiHash& other) noexcept
 {
+#if VALIDATE >= 1
+	if(!matches(CORR, HashItemCorr::MASK_CORANY) && other.empty())
+		throw domain_error("sub() other, empty digest is prohibited in the input\n");
+#endif // VALIDATE
 #if VALIDATE >= 2
 	if(empty())
 		throw underflow_error("sub() other, subtraction from the empty hash\n");
 #endif // VALIDATE
-	throw logic_error("sub() other is not implemented\n");
+
+	// Note: the borrows are subtracted from the high parts together with the high parts
+	// of the other to validate the underflow
+	const Size  hbrw = csub(m_lsum, other.m_lsum);
+	const Size  hv2brw = csub(m_lv2sum, other.m_lv2sum);
+#if VALIDATE >= 1
+	if(m_hsum < other.m_hsum || m_hsum - other.m_hsum < hbrw
+	|| m_hv2sum < other.m_hv2sum || m_hv2sum - other.m_hv2sum < hv2brw)
+		throw underflow_error("sub() other, the chunk was not hashed\n");
+#endif // VALIDATE
+	m_hsum -= other.m_hsum + hbrw;
+	m_hv2sum -= other.m_hv2sum + hv2brw;
+
+	// Revert the zero substitution of the empty chunk performed on the addition
+	if(CORR == HashItemCorr::COR0 && other.empty())
+		m_hv2sum -= csub(m_lv2sum, zsval);  // Zero substitution
 }
 
 template <typename UInt, typename Size, HashItemCorr CORR>
 void AgordiHash<UInt, Size, CORR>::sub(UInt v, Size num) noexcept
 {
-#if VALIDATE >= 2
-	if(empty())
-		throw underflow_error("sub() num, subtraction from the empty hash\n");
-#endif // VALIDATE
-	throw logic_error("sub() num is not implemented\n");
+	if(num)
+		sub(multiple(v, num));
 }
 
 template <typename UInt, typename Size, HashItemCorr CORR>
 bool AgordiHash<UInt, Size, CORR>::empty() const noexcept
 {
-	static_assert(sizeof *this == sizeof(Data), "empty(), Data size validation failed");
 	//constexpr static Data  zero{0};  // Initialize with zero
 	constexpr static array<uint8_t, sizeof(AgordiHash)>  zero{0};  // Initialize with zero
 
@@ -589,17 +776,102 @@ size_t AgordiHash<UInt, Size, CORR>::operator()() const noexcept
 	return res;
 }
 
+template <typename UInt, typename Size, HashItemCorr CORR>
+void AgordiHash<UInt, Size, CORR>::encrypt(uint8_t* data, size_t size) noexcept
+{
+	//! Bijective non-linear mixing of the 64-bit word (the finalizer of MurmurHash3)
+	auto fmix = [](uint64_t w) noexcept -> uint64_t {
+		w ^= w >> 33;
+		w *= 0xff51afd7ed558ccdULL;
+		w ^= w >> 33;
+		w *= 0xc4ceb9fe1a85ec53ULL;
+		w ^= w >> 33;
+		return w;
+	};
+	// Note: each step mixes a disjoint window with the key derived from the previous
+	// output window, which is not modified afterwards in the pass, and each pass starts
+	// from the initial key. So each pass and the whole transformation are invertible,
+	// i.e. collision-free.
+#if VALIDATE >= 2
+	assert(size && !(size % sizeof(uint64_t)) && "encrypt(), the size should be a positive multiple of 8");
+#endif // VALIDATE
+	uint64_t  key;
+	//! Mix the window at the specified offset
+	auto mix = [data, &key, fmix](size_t pos) noexcept {
+		uint64_t  w;
+		memcpy(&w, data + pos, sizeof w);
+		w = fmix(w ^ key);
+		memcpy(data + pos, &w, sizeof w);
+		key = (w << 29 | w >> 35) + 0x9e3779b97f4a7c15ULL;
+	};
+	// Forward and backward passes to diffuse each byte to the whole data
+	key = 0x9e3779b97f4a7c15ULL;  // Initial key, the golden ratio
+	for(size_t pos = 0; pos < size; pos += sizeof key)
+		mix(pos);
+	key = 0x9e3779b97f4a7c15ULL;
+	for(size_t pos = size; pos; )
+		mix(pos -= sizeof key);
+}
+
+template <typename UInt, typename Size, HashItemCorr CORR>
+void AgordiHash<UInt, Size, CORR>::decrypt(uint8_t* data, size_t size) noexcept
+{
+	//! Inverse of the fmix() in encrypt(), the multipliers are the modular inverses
+	auto fmixInv = [](uint64_t w) noexcept -> uint64_t {
+		w ^= w >> 33;  // Note: the shift >= 32 is self-inverse
+		w *= 0x9cb4b2f8129337dbULL;
+		w ^= w >> 33;
+		w *= 0x4f74430c22a54005ULL;
+		w ^= w >> 33;
+		return w;
+	};
+#if VALIDATE >= 2
+	assert(size && !(size % sizeof(uint64_t)) && "decrypt(), the size should be a positive multiple of 8");
+#endif // VALIDATE
+	uint64_t  key;
+	//! Unmix the window at the specified offset
+	auto unmix = [data, &key, fmixInv](size_t pos) noexcept {
+		uint64_t  w;
+		memcpy(&w, data + pos, sizeof w);
+		const uint64_t  wkey = (w << 29 | w >> 35) + 0x9e3779b97f4a7c15ULL;  // Key of the next window
+		w = fmixInv(w) ^ key;
+		memcpy(data + pos, &w, sizeof w);
+		key = wkey;
+	};
+	// Undo the backward and then the forward passes of encrypt()
+	key = 0x9e3779b97f4a7c15ULL;
+	for(size_t pos = size; pos; )
+		unmix(pos -= sizeof key);
+	key = 0x9e3779b97f4a7c15ULL;
+	for(size_t pos = 0; pos < size; pos += sizeof key)
+		unmix(pos);
+}
+
 template <typename UInt, typename Size, HashItemCorr CORR>
 auto AgordiHash<UInt, Size, CORR>::encrypted() const -> Data
 {
-	//Data  data(sizeof(AgordiHash));
-	throw logic_error("encrypted() is not implemented\n");
+	// ATTENTION: requires filling with zero memory alignment padding or avoid the padding
+	Data  data(encSize(), 0);  // Note: the tail is zero-padded to the 8-byte windows
+	memcpy(data.data(), this, sizeof *this);
+	encrypt(data.data(), data.size());
+	return data;
 }
 
 template <typename UInt, typename Size, HashItemCorr CORR>
 size_t AgordiHash<UInt, Size, CORR>::edigest() const noexcept
 {
-	throw logic_error("edigest() is not implemented\n");
+	// Note: the local storage avoids the allocation, the tail is zero-padded to the 8-byte windows
+	array<uint8_t, encSize()>  data{};
+	memcpy(data.data(), this, sizeof *this);
+	encrypt(data.data(), data.size());
+	// Fold the encrypted data into the digest
+	uint64_t  res = 0;
+	for(size_t pos = 0; pos < data.size(); pos += sizeof res) {
+		uint64_t  w;
+		memcpy(&w, data.data() + pos, sizeof w);
+		res = (res << 23 | res >> 41) ^ w;
+	}
+	return static_cast<size_t>(res);
 }
 
 template <typename UInt, typename Size, HashItemCorr CORR>
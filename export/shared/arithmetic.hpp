@@ -16,6 +16,8 @@
 // MACROSES:
 //  - UTEST  - make some internal class members public for the unit testing
 //	- MACRODEF_H  - do not include 'macrodef.h' if MACRODEF_H is defined
+//	- ACCINT_PORTABLE  - use the portable emulation of the AccInt arithmetic
+//	even if the native 128 bit integers are supported by the compiler
 // Usually, should not be touched ----------------------------------------------
 //  - CPU_LITTLE_ENDIAN {0,1}  - use the big/little-endian bytes order instead of the automatic identification.
 //  	ATTENTNION: results incorrect evaluations on the little-endian architecture.
@@ -83,6 +85,16 @@
 	#warning "Compiling for the big-endian architecture."
 #endif // TRACE
 
+// Native 128 bit integers (GCC, Clang, ICC on 64 bit platforms), which are
+// compiled to add/adc, sub/sbb and a single mul instead of the manual carrying
+#if !defined(ACCINT_NATIVE128)
+	#if defined(__SIZEOF_INT128__) && !defined(ACCINT_PORTABLE)
+		#define ACCINT_NATIVE128  1
+	#else
+		#define ACCINT_NATIVE128  0
+	#endif // __SIZEOF_INT128__
+#endif // ACCINT_NATIVE128
+
 
 namespace daoc {
 
@@ -94,6 +106,7 @@ using std::is_unsigned;
 using std::make_unsigned_t;
 using std::make_signed_t;
 using std::enable_if_t;
+using std::is_same;
 #if VALIDATE >= 2
 using std::logic_error;  // Note implemented
 #endif // VALIDATE 2
@@ -416,6 +429,60 @@ struct DoubledInt<uint32_t> {
 template <typename IntT>
 using DoubledIntT = typename DoubledInt<IntT>::type;
 
+// Native Backend of AccInt ----------------------------------------------------
+//! \brief Native unsigned integral type of the AccInt<UIntT> size if available
+//! \note Void if the native type is not available
+template <typename UIntT, typename Enable=void>
+struct NativeAccUInt {
+	using type = void;
+};
+
+template <typename UIntT>
+struct NativeAccUInt<UIntT, enable_if_t<is_unsigned<UIntT>::value && sizeof(UIntT) <= sizeof(uint32_t)>> {
+	using type = DoubledIntT<UIntT>;
+};
+
+#if ACCINT_NATIVE128
+//! Native unsigned 128 bit integer
+//! \note __extension__ suppresses the -Wpedantic warning about the non-ISO type
+__extension__ typedef unsigned __int128  UInt128;
+
+template <>
+struct NativeAccUInt<uint64_t> {
+	using type = UInt128;
+};
+#endif // ACCINT_NATIVE128
+
+template <typename UIntT>
+using NativeAccUIntT = typename NativeAccUInt<UIntT>::type;
+
+//! \brief Whether the arithmetic of AccInt<UIntT> is performed natively
+template <typename UIntT>
+constexpr bool nativeAccInt() noexcept  { return !std::is_void<NativeAccUIntT<UIntT>>::value; }
+
+//! \brief Native value of the unsigned AccInt
+//!
+//! \param v const AccInt<UIntT>&  - the value
+//! \return NativeAccUIntT<UIntT>  - native value
+template <typename UIntT>
+inline NativeAccUIntT<UIntT> toNative(const AccInt<UIntT>& v) noexcept
+{
+	using NativeT = NativeAccUIntT<UIntT>;
+	return static_cast<NativeT>(v.high) << AccInt<UIntT>::hszbits | v.low;
+}
+
+//! \brief Assign the native value to the unsigned AccInt
+//!
+//! \param res AccInt<UIntT>&  - resulting value
+//! \param v NativeAccUIntT<UIntT>  - native value
+//! \return void
+template <typename UIntT>
+inline void fromNative(AccInt<UIntT>& res, NativeAccUIntT<UIntT> v) noexcept
+{
+	res.low = static_cast<UIntT>(v);
+	res.high = static_cast<UIntT>(v >> AccInt<UIntT>::hszbits);
+}
+
 // Arithmetic Operations -------------------------------------------------------
 //! \brief Sum of the unsigned integral numbers considering the overflow (carry flag)
 //!
@@ -433,7 +500,7 @@ csum(UValT& sum, ValCRef<UValT> v) noexcept
 }
 
 template <typename AccUIntT>
-enable_if_t<!is_integral<AccUIntT>::value, bool>
+enable_if_t<!is_integral<AccUIntT>::value && !nativeAccInt<typename AccUIntT::Value>(), bool>
 csum(AccUIntT& sum, ValCRef<AccUIntT> v) noexcept
 {
 	static_assert(is_integral<typename AccUIntT::Value>::value
@@ -444,6 +511,60 @@ csum(AccUIntT& sum, ValCRef<AccUIntT> v) noexcept
 	return csum(sum.high, v.high) || (ovf && sum.high == v.high);
 }
 
+template <typename AccUIntT>
+inline enable_if_t<!is_integral<AccUIntT>::value && nativeAccInt<typename AccUIntT::Value>(), bool>
+csum(AccUIntT& sum, ValCRef<AccUIntT> v) noexcept
+{
+	static_assert(is_unsigned<typename AccUIntT::Value>::value
+		, "csum(), AccInt of the unsigned integral is expected");
+	const auto  nv = toNative(v);
+	const auto  res = toNative(sum) + nv;
+	fromNative(sum, res);
+	return res < nv;
+}
+
+//! \brief Subtraction of the unsigned integral numbers considering the underflow (borrow flag)
+//!
+//! \param diff UValT&  - resulting difference
+//! \param v ValCRef<UValT>  - the value to be subtracted
+//! \return bool  - borrow flag (underflow), 0 or 1
+template <typename UValT>
+inline enable_if_t<is_integral<UValT>::value, bool>
+csub(UValT& diff, ValCRef<UValT> v) noexcept
+{
+	static_assert(is_integral<UValT>::value && is_unsigned<UValT>::value
+		, "csub(), unsigned integral value is expected of the fundamental type");
+	const bool  brw = diff < v;
+	diff -= v;
+	return brw;
+}
+
+template <typename AccUIntT>
+enable_if_t<!is_integral<AccUIntT>::value && !nativeAccInt<typename AccUIntT::Value>(), bool>
+csub(AccUIntT& diff, ValCRef<AccUIntT> v) noexcept
+{
+	static_assert(is_integral<typename AccUIntT::Value>::value
+		&& is_unsigned<typename AccUIntT::Value>::value
+		, "csub(), AccInt of the unsigned integral is expected");
+	const bool  brw = csub(diff.low, v.low);
+	bool  hbrw = csub(diff.high, v.high);
+	if(brw)
+		hbrw = csub(diff.high, typename AccUIntT::Value(1)) || hbrw;
+	return hbrw;
+}
+
+template <typename AccUIntT>
+inline enable_if_t<!is_integral<AccUIntT>::value && nativeAccInt<typename AccUIntT::Value>(), bool>
+csub(AccUIntT& diff, ValCRef<AccUIntT> v) noexcept
+{
+	static_assert(is_unsigned<typename AccUIntT::Value>::value
+		, "csub(), AccInt of the unsigned integral is expected");
+	const auto  nd = toNative(diff);
+	const auto  nv = toNative(v);
+	fromNative(diff, nd - nv);
+	return nd < nv;
+}
+
 //! \brief Square of the value
 //!
 //! \param v ValT  - the value to be squared
@@ -460,6 +581,9 @@ template <>
 AccInt<uint64_t> square<uint64_t>(uint64_t v) noexcept
 {
 	AccInt<uint64_t>  res;  // Use NRVO optimization for the return value
+#if ACCINT_NATIVE128
+	fromNative(res, static_cast<NativeAccUIntT<uint64_t>>(v) * v);
+#else
 
 	// cf(mulm_lsh) + cf(mulh)| ab^2 = a^2 << 2*sz + cf(mulm) | 2ab << sz + cf(mull) | b^2
 	//
@@ -502,6 +626,7 @@ AccInt<uint64_t> square<uint64_t>(uint64_t v) noexcept
 		";  hcf: %#llx, mmul: %#llx, halfvb: %u, lmul: %#llx\n"
 		, res.high, res.low, hcf, mmul, halfvb, lmul);
 #endif // TRACE
+#endif // ACCINT_NATIVE128
 
 	return res;
 }
@@ -523,6 +648,15 @@ void xorlsh(AccIntT& res, UValT val, uint8_t nbits)
 {
 	static_assert(is_integral<UValT>::value && is_unsigned<UValT>::value
 		&& sizeof(UValT) <= sizeof(AccIntT), "xorlsh(), input types are invalid");
+#if ACCINT_NATIVE128
+	if(is_same<AccIntT, AccInt<uint64_t>>::value) {
+		if(nbits < AccIntT::hszbits << 1) {
+			auto&  acc = reinterpret_cast<AccInt<uint64_t>&>(res);
+			fromNative(acc, toNative(acc) ^ static_cast<NativeAccUIntT<uint64_t>>(val) << nbits);
+		}
+		return;
+	}
+#endif // ACCINT_NATIVE128
 	// ATTENTION: if is require because the out of range (too large) shift is not deterministic
 	if(nbits < AccIntT::hszbits)
 		res.low ^= static_cast<typename AccIntT::UValue>(val) << nbits;
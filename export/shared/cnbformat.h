@@ -0,0 +1,61 @@
+//! \brief Cluster Nodes Binary membership (.cnb) format.
+//! The layout is shared by the DAOC library (CnlPrinter, CnbParser)
+//! and the standalone file IO utilities (loadNodeIds, loadMembership).
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#ifndef CNBFORMAT_H
+#define CNBFORMAT_H
+
+#include <cstdint>  // uintX_t
+
+
+namespace daoc {
+
+//! \brief Size of the binary format (HBS, CNB) section aligned to 8 bytes
+//!
+//! \param size uint64_t  - size of the section data in bytes
+//! \return uint64_t  - aligned size
+constexpr uint64_t binAligned(uint64_t size)
+{ return (size + 7) & ~uint64_t(7); }
+
+// Cluster Nodes Binary membership ---------------------------------------------
+//! Signature of the Cluster Nodes Binary format, including the terminating '\0'
+constexpr char CNB_SIGNATURE[8] = "DAOCCNB";
+
+//! \brief Header of the Cluster Nodes Binary membership (.cnb)
+//! \note The file consists of the following sections aligned to 8 bytes
+//! 	(the native byte order is used):
+//! 	- CnbHeader;
+//! 	- uint32_t cids[clsnum]  - cluster ids if CNB_NUMBERED;
+//! 	- uint64_t offsets[clsnum + 1]  - offsets of the cluster members;
+//! 	- uint32_t members[mbsnum]  - member node ids of the clusters;
+//! 	- float shares[mbsnum]  - shares of the members if CNB_SHARES,
+//! 		0 means the equal share among all owners of the node (omitted in the .cnl).
+struct CnbHeader {
+	constexpr static uint32_t  VERSION = 1;  //!< Version of the format
+
+	char  signature[sizeof CNB_SIGNATURE];  //!< Format signature
+	uint32_t  version;  //!< Format version
+	uint32_t  flags;  //!< CnbFlags
+	uint64_t  clsnum;  //!< The number of clusters
+	uint64_t  ndsnum;  //!< The number of nodes in the clustered graph, 0 if unknown
+	uint64_t  mbsnum;  //!< The total number of members in all clusters
+};
+
+//! Flags of the Cluster Nodes Binary membership
+enum CnbFlags: uint32_t {
+	CNB_NONE = 0,
+	CNB_SHARES = 1,  //!< Member shares are stored (fuzzy overlaps)
+	CNB_NUMBERED = 2  //!< Cluster ids are stored
+};
+
+}  // daoc
+
+#endif // CNBFORMAT_H
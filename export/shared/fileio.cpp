@@ -130,7 +130,9 @@ bool StringBuffer::readline(FILE* input)
 		&& "readline(), valid file stream should be specified and have initial m_cur = 0");
 #endif // VALIDATE
 	*data() = 0;  // Set first element to 0 as an initialization to have the empty string on errors
+#if VALIDATE >= 2
 	const auto ibeg = ftell(input);
+#endif // VALIDATE
 	// Read data from file until the string is read or an error occurs
 	while(fgets(data() + m_cur, size() - m_cur, input) && data()[size()-2]) {
 #if TRACE >= 3  // Verified
@@ -141,12 +143,16 @@ bool StringBuffer::readline(FILE* input)
 		resize(size() + (size() / (spagesize * 2) + 1) * spagesize);
 		data()[size() - 2] = 0;  // Set prelast element to 0
 	}
-	const auto iend = ftell(input);
+	// Note: the string length is evaluated from the appending position to avoid
+	// the file position requests on each line
+	m_length = m_cur + strlen(data() + m_cur);
 #if VALIDATE >= 2
+	const auto iend = ftell(input);
 	if(iend == -1 || ibeg == -1)
 		perror("ERROR, file position reading error");
 	const size_t  slen = strlen(data());
-	if(!((!m_cur || slen >= m_cur) && size_t(iend - ibeg) == slen)) {
+	if(!((!m_cur || slen >= m_cur) && slen == m_length
+	&& (iend == -1 || ibeg == -1 || size_t(iend - ibeg) == slen))) {
 		fprintf(stderr, "readline(), m_cur: %lu, slen: %lu, dpos: %li,  str: %s\n"
 			, m_cur, slen, iend - ibeg, data());
 		assert(0 && "readline(), string size validation failed");
@@ -155,9 +161,6 @@ bool StringBuffer::readline(FILE* input)
 	m_cur = 0;  // Reset the writing (appending) position
 	// Note: prelast and last elements of the buffer will be always zero
 
-	// Set string length
-	m_length = iend != -1 && ibeg != -1 ? iend - ibeg : strlen(data());
-
 	// Check for errors
 	if((!m_length && feof(input)) || ferror(input)) {
 		if(ferror(input))
@@ -288,6 +291,93 @@ void parseCnlHeader(NamedFileWrapper& fcls, StringBuffer& line, size_t& clsnum
 #endif // TRACE
 }
 
+string loadCnlBody(NamedFileWrapper& file, bool verbose)
+{
+	size_t  clsnum = 0;  // The number of clusters
+	size_t  ndsnum = 0;  // The number of nodes
+	StringBuffer  line;  // Reading line
+	// Parse header and read the number of clusters if specified
+	// Note: line includes terminating '\n'
+	parseCnlHeader(file, line, clsnum, ndsnum, verbose);
+
+	// Load the remained content of the file including the already read line
+	string  text(static_cast<const char*>(line), line.length());
+	if(text.empty() || text.back() != '\n')
+		text += '\n';
+	const long  pos = ftell(file);
+	const size_t  fsize = file.size();
+	if(pos >= 0 && fsize != size_t(-1) && fsize > size_t(pos))
+		text.reserve(text.size() + fsize - pos + 1);
+	// Note: the file might be extended after its size evaluation or be a stream
+	char  buf[1 << 16];
+	for(size_t num; (num = fread(buf, 1, sizeof buf, file)); )
+		text.append(buf, num);
+	return text;
+}
+
+vector<size_t> lineChunks(const string& text, unsigned chunks)
+{
+	vector<size_t>  bounds(chunks + 1, text.size());
+	bounds[0] = 0;
+	for(unsigned ic = 1; ic < chunks; ++ic) {
+		size_t  pos = std::max<size_t>(text.size() * ic / chunks, bounds[ic - 1]);
+		pos = text.find('\n', pos);
+		bounds[ic] = pos != string::npos ? pos + 1 : text.size();
+	}
+	return bounds;
+}
+
+bool isCnbInput(FILE* file) noexcept
+{
+	const int  c = getc(file);
+	if(c == EOF)
+		return false;
+	ungetc(c, file);
+	return c == CNB_SIGNATURE[0];
+}
+
+bool loadCnb(NamedFileWrapper& file, CnbHeader& hdr, vector<uint64_t>& offsets
+	, vector<uint32_t>& members)
+{
+	if(fread(&hdr, sizeof hdr, 1, file) != 1
+	|| memcmp(hdr.signature, CNB_SIGNATURE, sizeof CNB_SIGNATURE) || hdr.version != CnbHeader::VERSION) {
+		fprintf(stderr, "WARNING loadCnb(), invalid header of the binary membership: %s\n"
+			, file.name().c_str());
+		return false;
+	}
+	//! Read the section skipping its alignment
+	auto read = [&file](void* data, size_t size, size_t num) -> bool {
+		if(fread(data, size, num, file) != num)
+			return false;
+		for(size_t pad = binAligned(size * num) - size * num; pad; --pad)
+			if(getc(file) == EOF)
+				return false;
+		return true;
+	};
+	static_assert(sizeof(CnbHeader) == binAligned(sizeof(CnbHeader)), "loadCnb(), the header should be aligned");
+	bool  valid = true;  // The membership is valid
+	// Skip the cluster ids reading them sequentially, which is applicable for the pipes
+	if(valid && hdr.flags & CNB_NUMBERED) {
+		vector<uint32_t>  cids(hdr.clsnum);
+		valid = read(cids.data(), sizeof(uint32_t), cids.size());
+	}
+	if(valid) {
+		offsets.resize(hdr.clsnum + 1);
+		members.resize(hdr.mbsnum);
+		valid = read(offsets.data(), sizeof(uint64_t), offsets.size())
+			&& read(members.data(), sizeof(uint32_t), members.size())
+			&& !offsets.front() && offsets.back() == hdr.mbsnum
+			&& std::is_sorted(offsets.begin(), offsets.end());
+	}
+	if(!valid) {
+		offsets.clear();
+		members.clear();
+		fprintf(stderr, "WARNING loadCnb(), the binary membership is corrupted: %s\n"
+			, file.name().c_str());
+	}
+	return valid;
+}
+
 size_t estimateCnlNodes(size_t filesize, float membership) noexcept
 {
 	if(membership <= 0) {
@@ -24,6 +24,11 @@
 // For the template definitions
 #include <cstring>  // strtok
 #include <cmath>  // sqrt
+#include <atomic>
+#include <memory>  // unique_ptr
+#include <algorithm>  // sort, unique, set_union
+#include <iterator>  // back_inserter
+#include <limits>  // numeric_limits
 
 #ifdef INCLUDE_STL_FS
 #if defined(__has_include) && __has_include(<filesystem>)
@@ -38,6 +43,9 @@
 #endif // INCLUDE_STL_FS
 
 #include "agghash.hpp"
+#include "parallel.hpp"
+#include "flathash.hpp"
+#include "cnbformat.h"  // CnbHeader
 
 //#include "types.h"
 
@@ -296,21 +304,133 @@ void parseCnlHeader(NamedFileWrapper& fcls, StringBuffer& line, size_t& clsnum
 //!
 //! \tparam Id  - Node id type
 //! \tparam AccId  - Accumulated node ids type
+//! \tparam NodesT  - Node base type, a set of the unique node ids constructible
+//! 	from the range of ids and the number of buckets, e.g. FlatHashSet<Id>
 //!
 //! \param file NamedFileWrapper&  - input collection of clusters in the CNL format
 //! \param membership=1 float  - expected membership of the nodes, >0, typically >= 1.
-//! Used only for the node container preallocation to estimate the number of nodes
-//! if not specified in the file header
+//! Retained for the compatibility, the node base is allocated for the exact number
+//! of the loaded nodes
 //! \param ahash=nullptr AggHash<Id, AccId>*  - resulting aggregated hash of the loaded
 //! node ids if not nullptr
 //! \param cmin=0 size_t  - min allowed cluster size
 //! \param cmax=0 size_t  - max allowed cluster size, 0 means any size
 //! \param verbose=true bool  - print the number of loaded nodes to the stdout
-//! \return bool  - the collection is loaded successfully
-template <typename Id, typename AccId>
-unordered_set<Id> loadNodes(NamedFileWrapper& file, float membership=1
+//! \return NodesT  - the loaded node base
+template <typename Id, typename AccId, typename NodesT=unordered_set<Id>>
+NodesT loadNodes(NamedFileWrapper& file, float membership=1
 	, AggHash<Id, AccId>* ahash=nullptr, size_t cmin=0, size_t cmax=0, bool verbose=true);
 
+//! \brief Load all unique node ids from the CNL or binary CNL (.cnb) file with
+//! 	optional filtering by the cluster size
+//! \note The textual input is parsed in parallel by the line-aligned chunks without
+//! 	the intermediate copying of the clusters. The ids are deduplicated by the bitmap
+//! 	if they are dense, otherwise by the parallel sorting and merging
+//!
+//! \tparam Id  - Node id type
+//! \tparam AccId  - Accumulated node ids type
+//!
+//! \param file NamedFileWrapper&  - input collection of clusters
+//! \param ahash=nullptr AggHash<Id, AccId>*  - resulting aggregated hash of the loaded
+//! node ids if not nullptr
+//! \param cmin=0 size_t  - min allowed cluster size
+//! \param cmax=0 size_t  - max allowed cluster size, 0 means any size
+//! \param verbose=true bool  - print the number of loaded nodes to the stdout
+//! \param workers=0 unsigned  - max number of workers, 0 means the number of
+//! 	the hardware threads
+//! \return vector<Id>  - ordered unique node ids
+template <typename Id, typename AccId>
+vector<Id> loadNodeIds(NamedFileWrapper& file, AggHash<Id, AccId>* ahash=nullptr
+	, size_t cmin=0, size_t cmax=0, bool verbose=true, unsigned workers=0);
+
+//! \brief Load the body of the CNL file following its header
+//! \note The file is read sequentially till the end, so it might be a pipe
+//!
+//! \param file NamedFileWrapper&  - input CNL file positioned at its beginning
+//! \param verbose=false bool  - print information about the header parsing issue to the stdout
+//! \return string  - the body including the first non-header line, terminated with '\n'
+string loadCnlBody(NamedFileWrapper& file, bool verbose=false);
+
+//! \brief Split the text into the chunks aligned by lines
+//!
+//! \param text const string&  - the text to be split
+//! \param chunks unsigned  - the number of chunks, >= 1
+//! \return vector<size_t>  - bounds of the chunks, chunks + 1 items
+vector<size_t> lineChunks(const string& text, unsigned chunks);
+
+//! \brief Clusters parsed from the chunk of the CNL body
+//!
+//! \tparam Id  - Node id type
+template <typename Id>
+struct CnlChunk {
+	vector<Id>  members;  //!< Member ids of the filtered clusters
+	vector<size_t>  offsets;  //!< Offsets of the filtered clusters members if requested, starts with 0
+	Id  idmin = numeric_limits<Id>::max();  //!< Min member id
+	Id  idmax = 0;  //!< Max member id
+	size_t  mbsnum = 0;  //!< The number of read members of all clusters
+	size_t  clsnum = 0;  //!< The number of read clusters
+};
+
+//! \brief Parse the clusters from the line-aligned chunk of the CNL body
+//! \note The cluster ids and member shares are skipped
+//!
+//! \tparam Id  - Node id type
+//!
+//! \param str const char*  - begin of the chunk
+//! \param end const char*  - end of the chunk
+//! \param[out] chunk CnlChunk<Id>&  - resulting parsed clusters
+//! \param cmin=0 size_t  - min allowed cluster size
+//! \param cmax=0 size_t  - max allowed cluster size, 0 means any size
+//! \param offsets=false bool  - form offsets of the cluster members
+//! \return void
+template <typename Id>
+void parseCnlChunk(const char* str, const char* end, CnlChunk<Id>& chunk
+	, size_t cmin=0, size_t cmax=0, bool offsets=false);
+
+//! \brief Ordered unique ids from the parts of ids
+//!
+//! \tparam Id  - Node id type
+//! \tparam AccId  - Accumulated node ids type
+//!
+//! \param parts vector<vector<Id>>&  - parts of ids, the content is reordered
+//! \param idmin Id  - min id in the parts
+//! \param idmax Id  - max id in the parts
+//! \param workers unsigned  - the number of workers, >= 1
+//! \param ahash AggHash<Id, AccId>*  - resulting aggregated hash of the unique ids
+//! 	accumulated on their emission if not nullptr
+//! \return vector<Id>  - ordered unique ids
+template <typename Id, typename AccId>
+vector<Id> uniqueIds(vector<vector<Id>>& parts, Id idmin, Id idmax, unsigned workers
+	, AggHash<Id, AccId>* ahash);
+
+//! \brief Whether the input starts with the binary membership (.cnb) signature
+//! \note Only the first char is peeked and put back, so the textual input
+//! 	is not affected and might be a pipe
+//!
+//! \param file FILE*  - input file
+//! \return bool  - the input is expected to be a binary membership
+bool isCnbInput(FILE* file) noexcept;
+
+//! \brief Load the binary membership (.cnb) from the current position sequentially
+//! \note The cluster ids and shares are skipped, the sections are read without
+//! 	seeking, so the input might be a pipe
+//!
+//! \param file NamedFileWrapper&  - input binary membership
+//! \param[out] hdr CnbHeader&  - the membership header
+//! \param[out] offsets vector<uint64_t>&  - offsets of the cluster members, clsnum + 1 items
+//! \param[out] members vector<uint32_t>&  - member node ids of the clusters
+//! \return bool  - the membership is loaded and valid, otherwise the warning is printed
+bool loadCnb(NamedFileWrapper& file, CnbHeader& hdr, vector<uint64_t>& offsets
+	, vector<uint32_t>& members);
+
+//! \brief Load all unique nodes from the binary CNL membership (.cnb)
+//! \pre The file position is at the beginning of the membership, the file might be a pipe
+//!
+//! \copydetails loadNodes
+template <typename Id, typename AccId, typename NodesT=unordered_set<Id>>
+NodesT loadCnbNodes(NamedFileWrapper& file, AggHash<Id, AccId>* ahash=nullptr
+	, size_t cmin=0, size_t cmax=0, bool verbose=true);
+
 //! \brief Estimate the number of nodes from the CNL file size
 //!
 //! \param filesize size_t  - the number of bytes in the CNL file
@@ -334,122 +454,278 @@ size_t estimateClusters(size_t ndsnum, float membership=1.f) noexcept;
 constexpr const char* toYesNo(bool val) noexcept  { return val ? "yes" : "no"; }
 
 // File I/O templates definition -----------------------------------------------
-template <typename Id, typename AccId>
-unordered_set<Id> loadNodes(NamedFileWrapper& file, float membership
+template <typename Id, typename AccId, typename NodesT>
+NodesT loadNodes(NamedFileWrapper& file, float /*membership*/
 	, AggHash<Id, AccId>* ahash, size_t cmin, size_t cmax, bool verbose)
 {
-	unordered_set<Id>  nodebase;  // Node base;  Note: returned using NRVO optimization
+	const auto  ids = loadNodeIds(file, ahash, cmin, cmax, verbose);
+	// Note: loadNodeIds() reports the number of loaded nodes if verbose
+	return NodesT(ids.begin(), ids.end(), ids.size());
+}
+
+template <typename Id, typename AccId, typename NodesT>
+NodesT loadCnbNodes(NamedFileWrapper& file, AggHash<Id, AccId>* ahash
+	, size_t cmin, size_t cmax, bool verbose)
+{
+	// Note: loadNodeIds() identifies the binary membership by its signature
+	const auto  ids = loadNodeIds(file, ahash, cmin, cmax, verbose);
+	// Note: loadNodeIds() reports the number of loaded nodes if verbose
+	return NodesT(ids.begin(), ids.end(), ids.size());
+}
+
+template <typename Id, typename AccId>
+vector<Id> loadNodeIds(NamedFileWrapper& file, AggHash<Id, AccId>* ahash
+	, size_t cmin, size_t cmax, bool verbose, unsigned workers)
+{
+	vector<Id>  ids;  // Note: returned using NRVO optimization
 
 	if(!file)
-		return nodebase;
-
-	// Note: CNL [CSN] format only is supported
-	size_t  clsnum = 0;  // The number of clusters
-	size_t  ndsnum = 0;  // The number of nodes
-
-	// Note: strings defined out of the cycle to avoid reallocations
-	StringBuffer  line;  // Reading line
-	// Parse header and read the number of clusters if specified
-	// Note: line includes terminating '\n'
-	parseCnlHeader(file, line, clsnum, ndsnum, verbose);
-
-	// Estimate the number of nodes in the file if not specified
-	if(!ndsnum) {
-		size_t  cmsbytes = file.size();
-		if(cmsbytes != size_t(-1))  // File length fetching failed
-			ndsnum = estimateCnlNodes(cmsbytes, membership);
-		else if(clsnum)
-			ndsnum = 2 * clsnum; // / membership;  // Note: use optimistic estimate instead of pessimistic (square / membership) to not overuse the memory
-#if TRACE >= 2
-		fprintf(stderr, "loadNodes(), estimated %lu nodes\n", ndsnum);
-#endif // TRACE
-	}
-#if TRACE >= 2
-	else fprintf(stderr, "loadNodes(), specified %lu nodes\n", ndsnum);
-#endif // TRACE
-
-	// Preallocate space for nodes
-	if(ndsnum)
-		nodebase.reserve(ndsnum);
-
-	// Load clusters
-	// ATTENTION: without '\n' delimiter the terminating '\n' is read as an item
-	constexpr char  mbdelim[] = " \t\n";  // Delimiter for the members
-	vector<Id>  cnds;  // Cluster nodes. Note: a dedicated container is required to filter clusters by size
-	cnds.reserve(sqrt(ndsnum));  // Note: typically cluster size does not increase the square root of the number of nodes
-#if TRACE >= 2
+		return ids;
+
+	vector<vector<Id>>  parts;  // Ids of the filtered clusters loaded by each worker
+	Id  idmin = numeric_limits<Id>::max();  // Min loaded id
+	Id  idmax = 0;  // Max loaded id
 	size_t  totmbs = 0;  // The number of read member nodes from the file including repetitions
 	size_t  fclsnum = 0;  // The number of read clusters from the file
-#endif // TRACE
-	do {
-#if TRACE >= 3
-		// Note: line includes terminating '\n'
-		fprintf(stderr, "%lu> %s", fclsnum, static_cast<const char*>(line));
-#endif // TRACE
-		char *tok = strtok(line, mbdelim);  // const_cast<char*>(line.data())
-
-		// Skip comments
-		if(!tok || tok[0] == '#')
-			continue;
-		// Skip the cluster id if present
-		if(tok[strlen(tok) - 1] == '>') {
-			const char* cidstr = tok;
-			tok = strtok(nullptr, mbdelim);
-			// Skip empty clusters, which actually should not exist
-			if(!tok) {
-				fprintf(stderr, "WARNING loadNodes(), empty cluster"
-					" exists: '%s', skipped\n", cidstr);
-				continue;
+	//! Update the id range by the part
+	auto updateRange = [&idmin, &idmax](const vector<Id>& part, Id pmin, Id pmax) {
+		if(part.empty())
+			return;
+		if(pmin < idmin)
+			idmin = pmin;
+		if(pmax > idmax)
+			idmax = pmax;
+	};
+
+	// Load the binary membership if the signature is present
+	if(isCnbInput(file)) {
+		CnbHeader  hdr;
+		vector<uint64_t>  offsets;  // Offsets of the cluster members
+		vector<uint32_t>  members;  // Member node ids
+		if(!loadCnb(file, hdr, offsets, members))
+			return ids;
+		totmbs = hdr.mbsnum;
+		fclsnum = hdr.clsnum;
+		workers = workersNum(hdr.mbsnum, 1 << 16, workers);
+		parts.resize(workers);
+		vector<Id>  pmins(workers, numeric_limits<Id>::max());
+		vector<Id>  pmaxs(workers, 0);
+		parallelRanges(hdr.clsnum, [&](size_t ib, size_t ie, unsigned iw) {
+			auto&  part = parts[iw];
+			for(; ib < ie; ++ib) {
+				const size_t  csize = offsets[ib + 1] - offsets[ib];
+				// Filter the cluster by size
+				if(csize < cmin || (cmax && csize > cmax))
+					continue;
+				for(auto im = offsets[ib]; im < offsets[ib + 1]; ++im) {
+					const Id  nid = members[im];
+					if(nid < pmins[iw])
+						pmins[iw] = nid;
+					if(nid > pmaxs[iw])
+						pmaxs[iw] = nid;
+					part.push_back(nid);
+				}
 			}
+		}, workers);
+		for(unsigned iw = 0; iw < workers; ++iw)
+			updateRange(parts[iw], pmins[iw], pmaxs[iw]);
+	} else {
+		// Note: CNL [CSN] format is supported for the textual input
+		const string  text = loadCnlBody(file, verbose);
+		workers = workersNum(text.size(), 1 << 20, workers);
+		const auto  bounds = lineChunks(text, workers);
+		// Parse the chunks in parallel
+		vector<CnlChunk<Id>>  chunks(workers);
+		parallelRanges(workers, [&](size_t ic, size_t, unsigned) {
+			parseCnlChunk(text.data() + bounds[ic], text.data() + bounds[ic + 1], chunks[ic], cmin, cmax);
+		}, workers);
+		parts.resize(workers);
+		for(unsigned iw = 0; iw < workers; ++iw) {
+			auto&  chunk = chunks[iw];
+			parts[iw] = move(chunk.members);
+			updateRange(parts[iw], chunk.idmin, chunk.idmax);
+			totmbs += chunk.mbsnum;
+			fclsnum += chunk.clsnum;
 		}
-		do {
-			// Note: only node id is parsed, share part is skipped if exists,
-			// but potentially can be considered in NMI and F1 evaluation.
-			// In the latter case abs diff of shares instead of co occurrence
-			// counting should be performed.
-			Id  nid = strtoul(tok, nullptr, 10);
-#if VALIDATE >= 2
-			if(!nid && tok[0] != '0') {
-				fprintf(stderr, "WARNING loadNodes(), conversion error of '%s' into 0: %s\n"
-					, tok, strerror(errno));
-				continue;
-			}
-#endif // VALIDATE
-#if TRACE >= 2
-			++totmbs;  // Update the total number of read members
-#endif // TRACE
-			cnds.push_back(nid);
-		} while((tok = strtok(nullptr, mbdelim)));
-#if TRACE >= 2
-		++fclsnum;  // The number of valid read lines, i.e. clusters
-#endif // TRACE
-
-		// Filter read cluster by size
-		if(cnds.size() >= cmin && (!cmax || cnds.size() <= cmax))
-			nodebase.insert(cnds.begin(), cnds.end());
-		// Prepare outer vars for the next iteration
-		cnds.clear();
-	} while(line.readline(file));
-//	// Rehash the nodes decreasing the allocated space if required
-//	if(nodebase.size() <= nodebase.bucket_count() * nodebase.max_load_factor() / 3)
-//		nodebase.reserve(nodebase.size());
+	}
+
+	// Note: the nodes hash is accumulated on the emission of the ordered unique ids
+	ids = uniqueIds(parts, idmin, idmax, workers, ahash);
 #if TRACE >= 2
-	printf("loadNodes(), the loaded base has %lu nodes from the input %lu members of %lu clusters\n"
-		, nodebase.size(), totmbs, fclsnum);
+	printf("loadNodeIds(), the loaded base has %lu nodes from the input %lu members of %lu clusters\n"
+		, ids.size(), totmbs, fclsnum);
 #else
 	if(verbose)
-		printf("loadNodes(), nodebase nodes loaded: %lu\n", nodebase.size());
+		printf("loadNodeIds(), nodebase nodes loaded: %lu\n", ids.size());
 #endif // TRACE 2
 
-	// Evaluate nodes hash if required
-	if(ahash && nodebase.size()) {
-		AggHash<Id, AccId>  ndsh;
-		for(auto nid: nodebase)
-			ndsh.add(nid);
-		*ahash = move(ndsh);
+	return ids;
+}
+
+template <typename Id>
+void parseCnlChunk(const char* str, const char* end, CnlChunk<Id>& chunk
+	, size_t cmin, size_t cmax, bool offsets)
+{
+	auto&  members = chunk.members;
+	if(offsets && chunk.offsets.empty())
+		chunk.offsets.push_back(members.size());
+	//! Whether the char is a space except the '\n'
+	auto isSpace = [](char c) noexcept { return c == ' ' || c == '\t' || c == '\r'; };
+	//! Skip the spaces of the line returning whether any tokens remained
+	auto skipSpaces = [&str, end, isSpace]() noexcept {
+		while(str < end && isSpace(*str))
+			++str;
+		return str < end && *str != '\n';
+	};
+	while(str < end) {
+		const char*  eol = static_cast<const char*>(memchr(str, '\n', end - str));
+		if(!eol)
+			eol = end;
+		// Skip empty lines and comments
+		if(!skipSpaces() || *str == '#') {
+			str = eol + 1;
+			continue;
+		}
+		const size_t  cbeg = members.size();  // Begin of the cluster members
+		const char*  cid = nullptr;  // Cluster id if present
+		bool  first = true;  // The first token, which can be a cluster id
+		do {
+			const char*  tok = str;
+			Id  nid = 0;
+			for(; str < eol && *str >= '0' && *str <= '9'; ++str)
+				nid = nid * 10 + (*str - '0');
+			const bool  parsed = str != tok;
+			// Skip the share part if exists or the remained symbols of the token
+			while(str < eol && !isSpace(*str))
+				++str;
+			// Skip the cluster id if present
+			if(first && str[-1] == '>') {
+				cid = tok;
+				first = false;
+				continue;
+			}
+			first = false;
+			if(!parsed) {
+#if VALIDATE >= 2
+				fprintf(stderr, "WARNING parseCnlChunk(), conversion error of '%s' is skipped\n"
+					, string(tok, str).c_str());
+#endif // VALIDATE
+				continue;
+			}
+			if(nid < chunk.idmin)
+				chunk.idmin = nid;
+			if(nid > chunk.idmax)
+				chunk.idmax = nid;
+			members.push_back(nid);
+		} while(skipSpaces());
+		const size_t  csize = members.size() - cbeg;
+		// Skip empty clusters, which actually should not exist
+		if(!csize) {
+			if(cid)
+				fprintf(stderr, "WARNING parseCnlChunk(), empty cluster exists: '%s', skipped\n"
+					, string(cid, std::find_if(cid, eol, isSpace)).c_str());
+			str = eol + 1;
+			continue;
+		}
+		str = eol + 1;
+		chunk.mbsnum += csize;
+		++chunk.clsnum;
+		// Filter the read cluster by size
+		if(csize < cmin || (cmax && csize > cmax))
+			members.resize(cbeg);
+		else if(offsets)
+			chunk.offsets.push_back(members.size());
+	}
+}
+
+template <typename Id, typename AccId>
+vector<Id> uniqueIds(vector<vector<Id>>& parts, Id idmin, Id idmax, unsigned workers
+	, AggHash<Id, AccId>* ahash)
+{
+	vector<Id>  ids;  // Note: returned using NRVO optimization
+	if(ahash)
+		ahash->clear();
+	size_t  total = 0;  // The total number of ids in the parts
+	for(const auto& part: parts)
+		total += part.size();
+	if(!total)
+		return ids;
+
+	// The bitmap is used if it is not larger than the ids
+	const uint64_t  range = uint64_t(idmax - idmin) + 1;
+	if(range / 8 <= total * sizeof(Id)) {
+		const size_t  wsnum = (range + 63) / 64;  // The number of words in the bitmap
+		std::unique_ptr<std::atomic<uint64_t>[]>  bits(new std::atomic<uint64_t>[wsnum]);
+		for(size_t i = 0; i < wsnum; ++i)
+			bits[i].store(0, std::memory_order_relaxed);
+		parallelRanges(parts.size(), [&](size_t ib, size_t ie, unsigned) {
+			for(; ib < ie; ++ib)
+				for(auto nid: parts[ib]) {
+					const uint64_t  ind = nid - idmin;
+					bits[ind / 64].fetch_or(uint64_t(1) << ind % 64, std::memory_order_relaxed);
+				}
+		}, workers);
+		// Extract the ids by the ranges of words
+		workers = workersNum(wsnum, 1 << 12, workers);
+		vector<size_t>  counts(workers + 1, 0);  // Offsets of the ids of each range
+		parallelRanges(wsnum, [&](size_t ib, size_t ie, unsigned iw) {
+			size_t  cnt = 0;
+			for(; ib < ie; ++ib)
+				for(uint64_t w = bits[ib].load(std::memory_order_relaxed); w; w &= w - 1)
+					++cnt;
+			counts[iw + 1] = cnt;
+		}, workers);
+		for(unsigned iw = 0; iw < workers; ++iw)
+			counts[iw + 1] += counts[iw];
+		ids.resize(counts.back());
+		vector<AggHash<Id, AccId>>  hashes(ahash ? workers : 0);  // Hashes of the emitted ids of each range
+		parallelRanges(wsnum, [&](size_t ib, size_t ie, unsigned iw) {
+			auto  iid = ids.begin() + counts[iw];
+			for(; ib < ie; ++ib) {
+				uint64_t  w = bits[ib].load(std::memory_order_relaxed);
+				for(Id nid = idmin + ib * 64; w; w >>= 1, ++nid)
+					if(w & 1)
+						*iid++ = nid;
+			}
+			if(ahash)
+				hashes[iw].add(ids.data() + counts[iw], counts[iw + 1] - counts[iw]);
+		}, workers);
+		for(const auto& ndsh: hashes)
+			*ahash += ndsh;
+		return ids;
 	}
 
-	return nodebase;
+	// Sort and deduplicate each part, then merge the parts pairwise
+	parallelRanges(parts.size(), [&](size_t ib, size_t ie, unsigned) {
+		for(; ib < ie; ++ib) {
+			auto&  part = parts[ib];
+			std::sort(part.begin(), part.end());
+			part.erase(std::unique(part.begin(), part.end()), part.end());
+			// Note: the single part is final
+			if(ahash && parts.size() == 1)
+				ahash->add(part.data(), part.size());
+		}
+	}, workers);
+	for(size_t step = 1; step < parts.size(); step *= 2) {
+		const size_t  pairs = (parts.size() - step + 2 * step - 1) / (2 * step);
+		parallelRanges(pairs, [&](size_t ib, size_t ie, unsigned) {
+			for(; ib < ie; ++ib) {
+				auto&  dst = parts[ib * 2 * step];
+				auto&  src = parts[ib * 2 * step + step];
+				vector<Id>  merged;
+				merged.reserve(dst.size() + src.size());
+				std::set_union(dst.begin(), dst.end(), src.begin(), src.end()
+					, std::back_inserter(merged));
+				// Note: the last merge emits the final ids
+				if(ahash && step * 2 >= parts.size())
+					ahash->add(merged.data(), merged.size());
+				dst = move(merged);
+				vector<Id>().swap(src);  // Release the memory
+			}
+		}, workers);
+	}
+	ids = move(parts.front());
+	return ids;
 }
 
 }  // daoc
@@ -0,0 +1,521 @@
+//! \brief Open-addressing (flat) hash containers.
+//! The elements are stored inline in a single contiguous array using the
+//! Robin Hood linear probing with the backward shift deletion, the probe
+//! distances are stored in a separate byte array, so the lookups are
+//! cache-friendly and do not chase pointers.
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#ifndef FLATHASH_HPP
+#define FLATHASH_HPP
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint8_t
+#include <cstring>  // memset
+#include <memory>  // allocator, unique_ptr
+#include <utility>  // pair, move, swap, piecewise_construct
+#include <tuple>  // forward_as_tuple
+#include <functional>  // equal_to
+#include <iterator>  // forward_iterator_tag
+#include <stdexcept>  // out_of_range
+#include <initializer_list>
+#include <type_traits>  // conditional_t, is_trivially_destructible
+
+#include "hashing.hpp"  // SolidHash
+
+
+namespace daoc {
+
+using std::pair;
+using std::out_of_range;
+using std::conditional_t;
+
+//! \brief Key of the set element
+template <typename KeyT>
+struct SetKey {
+	static const KeyT& key(const KeyT& el) noexcept  { return el; }
+};
+
+//! \brief Key of the map element
+template <typename KeyT, typename ValT>
+struct MapKey {
+	static const KeyT& key(const pair<KeyT, ValT>& el) noexcept  { return el.first; }
+};
+
+//! \brief Open-addressing hash table with the Robin Hood linear probing
+//! \note The capacity is a power of 2, so the hash function should provide
+//! 	well-distributed lower bits (SolidHash does for the scalar keys) and
+//! 	should not map hundreds of keys to the same slot, since the probe
+//! 	distance is bounded by DIST_MAX.
+//! 	Iterators and references are invalidated by any insertion and erasure.
+//!
+//! \tparam KeyT  - key type
+//! \tparam ElT  - element (value_type) type, move constructible and assignable
+//! \tparam KeyOfT  - key accessor of the element
+//! \tparam HashT  - hash function of the key
+//! \tparam EqualT  - equality comparison of the keys
+template <typename KeyT, typename ElT, typename KeyOfT, typename HashT, typename EqualT>
+class FlatHashTable: HashT, EqualT {
+public:
+	using key_type = KeyT;
+	using value_type = ElT;
+	using size_type = size_t;
+	using hasher = HashT;
+	using key_equal = EqualT;
+	using reference = ElT&;
+	using const_reference = const ElT&;
+protected:
+	//! Probe distance of the slot: 0 - empty slot, otherwise the distance from
+	//! the home slot + 1
+	using Dist = uint8_t;
+
+	constexpr static Dist  DIST_MAX = 0xFF;  //!< Max probe distance, the table grows on reaching it
+	constexpr static size_t  CAPACITY_MIN = 8;  //!< Min non-zero capacity
+	constexpr static size_t  NPOS = size_t(-1);  //!< Non-existent position
+
+	ElT*  m_slots;  //!< Slots of the elements
+	Dist*  m_dists;  //!< Probe distances of the slots, capacity + 1 items with the sentinel
+	size_t  m_mask;  //!< Capacity - 1 for the non-empty table, otherwise 0
+	size_t  m_size;  //!< The number of elements
+
+	//! \brief Iterator of the elements
+	//!
+	//! \tparam CONST  - constant iterator
+	template <bool CONST>
+	class Iterator {
+		friend class FlatHashTable;
+		template <bool> friend class Iterator;
+
+		using Slot = conditional_t<CONST, const ElT, ElT>;
+
+		Slot*  m_slot;  //!< Current slot
+		const Dist*  m_dist;  //!< Probe distance of the current slot
+
+		//! \brief Skip the empty slots
+		//! \note The trailing sentinel distance is non-zero
+		void skip() noexcept
+		{
+			while(!*m_dist) {
+				++m_dist;
+				++m_slot;
+			}
+		}
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = ElT;
+		using difference_type = ptrdiff_t;
+		using pointer = Slot*;
+		using reference = Slot&;
+
+		//! \brief Constructor
+		//!
+		//! \param slot Slot*  - the slot
+		//! \param dist const Dist*  - probe distance of the slot
+		//! \param skipempty=false bool  - skip the empty slots
+		Iterator(Slot* slot=nullptr, const Dist* dist=nullptr, bool skipempty=false) noexcept
+		: m_slot(slot), m_dist(dist)
+		{
+			if(skipempty)
+				skip();
+		}
+
+		//! \brief Conversion of the mutable iterator to the constant one
+		template <bool C=CONST, typename = std::enable_if_t<C>>
+		Iterator(const Iterator<false>& it) noexcept
+		: m_slot(it.m_slot), m_dist(it.m_dist)  {}
+
+		reference operator*() const noexcept  { return *m_slot; }
+		pointer operator->() const noexcept  { return m_slot; }
+
+		Iterator& operator++() noexcept
+		{
+			++m_dist;
+			++m_slot;
+			skip();
+			return *this;
+		}
+
+		Iterator operator++(int) noexcept
+		{
+			Iterator  res = *this;
+			++*this;
+			return res;
+		}
+
+		bool operator==(const Iterator& it) const noexcept  { return m_slot == it.m_slot; }
+		bool operator!=(const Iterator& it) const noexcept  { return m_slot != it.m_slot; }
+	};
+public:
+	using iterator = Iterator<false>;
+	using const_iterator = Iterator<true>;
+
+	//! \brief Constructor
+	//!
+	//! \param size=0 size_t  - the number of elements to be reserved
+	//! \param hash=HashT() const HashT&  - hash function
+	//! \param equal=EqualT() const EqualT&  - keys comparison
+	explicit FlatHashTable(size_t size=0, const HashT& hash=HashT(), const EqualT& equal=EqualT())
+	: HashT(hash), EqualT(equal), m_slots(nullptr), m_dists(nullptr), m_mask(0), m_size(0)
+	{
+		if(size)
+			reserve(size);
+	}
+
+	//! \brief Copy constructor
+	FlatHashTable(const FlatHashTable& other)
+	: HashT(other), EqualT(other), m_slots(nullptr), m_dists(nullptr), m_mask(0), m_size(0)
+	{
+		if(!other.m_size)
+			return;
+		reserve(other.m_size);
+		for(const auto& el: other)
+			place(ElT(el));
+		m_size = other.m_size;
+	}
+
+	//! \brief Move constructor
+	FlatHashTable(FlatHashTable&& other) noexcept
+	: HashT(std::move(other)), EqualT(std::move(other)), m_slots(other.m_slots)
+	, m_dists(other.m_dists), m_mask(other.m_mask), m_size(other.m_size)
+	{
+		other.m_slots = nullptr;
+		other.m_dists = nullptr;
+		other.m_mask = 0;
+		other.m_size = 0;
+	}
+
+	FlatHashTable& operator=(FlatHashTable other) noexcept
+	{
+		swap(other);
+		return *this;
+	}
+
+	~FlatHashTable()
+	{
+		release();
+	}
+
+	void swap(FlatHashTable& other) noexcept
+	{
+		using std::swap;
+		swap(static_cast<HashT&>(*this), static_cast<HashT&>(other));
+		swap(static_cast<EqualT&>(*this), static_cast<EqualT&>(other));
+		swap(m_slots, other.m_slots);
+		swap(m_dists, other.m_dists);
+		swap(m_mask, other.m_mask);
+		swap(m_size, other.m_size);
+	}
+
+	// Capacity ----------------------------------------------------------------
+	size_t size() const noexcept  { return m_size; }
+	bool empty() const noexcept  { return !m_size; }
+
+    //! \brief The number of slots
+	size_t capacity() const noexcept  { return m_slots ? m_mask + 1 : 0; }
+
+    //! \brief Max load factor of the table: 0.8
+	constexpr static float max_load_factor() noexcept  { return 0.8f; }
+
+	float load_factor() const noexcept  { return m_slots ? float(m_size) / capacity() : 0; }
+
+    //! \brief Reserve the slots for the specified number of elements
+    //!
+    //! \param size size_t  - the number of elements
+    //! \return void
+	void reserve(size_t size)
+	{
+		size_t  cap = CAPACITY_MIN;
+		while(cap * 4 < size * 5)  // cap * max_load_factor() < size
+			cap *= 2;
+		if(cap > capacity())
+			rehash(cap);
+	}
+
+	// Iterators ---------------------------------------------------------------
+	iterator begin() noexcept  { return m_slots ? iterator(m_slots, m_dists, true) : iterator(); }
+	const_iterator begin() const noexcept  { return m_slots ? const_iterator(m_slots, m_dists, true) : const_iterator(); }
+	const_iterator cbegin() const noexcept  { return begin(); }
+
+	iterator end() noexcept  { return m_slots ? iterator(m_slots + m_mask + 1, m_dists + m_mask + 1) : iterator(); }
+	const_iterator end() const noexcept  { return m_slots ? const_iterator(m_slots + m_mask + 1, m_dists + m_mask + 1) : const_iterator(); }
+	const_iterator cend() const noexcept  { return end(); }
+
+	// Lookup ------------------------------------------------------------------
+	iterator find(const KeyT& key) noexcept
+	{
+		const size_t  i = locate(key);
+		return i != NPOS ? iterator(m_slots + i, m_dists + i) : end();
+	}
+
+	const_iterator find(const KeyT& key) const noexcept
+	{
+		const size_t  i = locate(key);
+		return i != NPOS ? const_iterator(m_slots + i, m_dists + i) : end();
+	}
+
+	size_t count(const KeyT& key) const noexcept  { return locate(key) != NPOS; }
+
+	// Modifiers ---------------------------------------------------------------
+    //! \brief Remove all elements retaining the capacity
+	void clear() noexcept
+	{
+		if(!m_size)
+			return;
+		if(std::is_trivially_destructible<ElT>::value)
+			memset(m_dists, 0, m_mask + 1);
+		else for(size_t i = 0; i <= m_mask; ++i)
+			if(m_dists[i]) {
+				m_slots[i].~ElT();
+				m_dists[i] = 0;
+			}
+		m_size = 0;
+	}
+
+    //! \brief Insert the element if its key does not exist
+    //!
+    //! \param el ElT  - the element
+    //! \return pair<iterator, bool>  - iterator to the element with the key and
+    //! 	whether the insertion has been performed
+	pair<iterator, bool> insert(ElT el)
+	{
+		size_t  i = locate(KeyOfT::key(el));
+		if(i != NPOS)
+			return {iterator(m_slots + i, m_dists + i), false};
+		if((m_size + 1) * 5 > capacity() * 4)
+			rehash(capacity() ? capacity() * 2 : CAPACITY_MIN);
+		KeyT  key = KeyOfT::key(el);
+		i = place(std::move(el));
+		++m_size;
+		if(i == NPOS)
+			i = locate(key);  // The table has been rehashed during the placement
+		return {iterator(m_slots + i, m_dists + i), true};
+	}
+
+    //! \brief Erase the element by the key
+    //!
+    //! \param key const KeyT&  - the key
+    //! \return size_t  - the number of erased elements, 0 or 1
+	size_t erase(const KeyT& key) noexcept
+	{
+		const size_t  i = locate(key);
+		if(i == NPOS)
+			return 0;
+		remove(i);
+		return 1;
+	}
+
+    //! \brief Erase the element by the iterator
+    //! \note The backward shift deletion moves the subsequent elements of the
+    //! 	probe sequence to the preceding slots wrapping around the end of the
+    //! 	table, so the erasure invalidates all iterators and does not yield
+    //! 	the following element
+    //!
+    //! \param it const_iterator  - iterator of the erasing element
+	void erase(const_iterator it) noexcept
+	{
+		remove(it.m_slot - m_slots);
+	}
+protected:
+    //! \brief Position of the element by the key
+    //!
+    //! \param key const KeyT&  - the key
+    //! \return size_t  - position of the element or NPOS
+	size_t locate(const KeyT& key) const noexcept
+	{
+		if(!m_size)
+			return NPOS;
+		size_t  i = HashT::operator()(key) & m_mask;
+		for(Dist dist = 1; m_dists[i] >= dist; ++dist) {
+			if(m_dists[i] == dist && EqualT::operator()(KeyOfT::key(m_slots[i]), key))
+				return i;
+			i = (i + 1) & m_mask;
+		}
+		return NPOS;
+	}
+
+    //! \brief Place the element that is absent in the table having a free slot
+    //! \note The size is not updated
+    //!
+    //! \param el ElT&&  - the element
+    //! \return size_t  - position of the element or NPOS if the table has been
+    //! 	rehashed on the probe distance overflow
+	size_t place(ElT&& el)
+	{
+		size_t  i = HashT::operator()(KeyOfT::key(el)) & m_mask;
+		size_t  res = NPOS;
+		for(Dist dist = 1;; i = (i + 1) & m_mask) {
+			if(!m_dists[i]) {
+				new(m_slots + i) ElT(std::move(el));
+				m_dists[i] = dist;
+				return res != NPOS ? res : i;
+			}
+			// Robin Hood: take the slot of the element closer to its home slot
+			if(m_dists[i] < dist) {
+				using std::swap;
+				swap(el, m_slots[i]);
+				swap(dist, m_dists[i]);
+				if(res == NPOS)
+					res = i;
+			}
+			if(++dist == DIST_MAX) {
+				// Note: el is the displaced element, which is absent in the table
+				rehash(capacity() * 2);
+				place(std::move(el));
+				return NPOS;
+			}
+		}
+	}
+
+    //! \brief Remove the element at the specified position shifting backward
+    //! the following displaced elements
+    //!
+    //! \param i size_t  - position of the removing element
+    //! \return void
+	void remove(size_t i) noexcept
+	{
+		m_slots[i].~ElT();
+		for(size_t j = (i + 1) & m_mask; m_dists[j] > 1; i = j, j = (j + 1) & m_mask) {
+			new(m_slots + i) ElT(std::move(m_slots[j]));
+			m_slots[j].~ElT();
+			m_dists[i] = m_dists[j] - 1;
+		}
+		m_dists[i] = 0;
+		--m_size;
+	}
+
+    //! \brief Rehash the table to the specified capacity
+    //!
+    //! \param cap size_t  - new capacity, a power of 2 exceeding the size
+    //! \return void
+	void rehash(size_t cap)
+	{
+		ElT*  slots = m_slots;
+		Dist*  dists = m_dists;
+		const size_t  ocap = capacity();
+
+		m_slots = std::allocator<ElT>().allocate(cap);
+		try {
+			m_dists = new Dist[cap + 1];
+		} catch(...) {
+			std::allocator<ElT>().deallocate(m_slots, cap);
+			m_slots = slots;
+			throw;
+		}
+		memset(m_dists, 0, cap);
+		m_dists[cap] = DIST_MAX;  // Sentinel for the iteration
+		m_mask = cap - 1;
+		for(size_t i = 0; i < ocap; ++i)
+			if(dists[i]) {
+				place(std::move(slots[i]));
+				slots[i].~ElT();
+			}
+		if(slots) {
+			std::allocator<ElT>().deallocate(slots, ocap);
+			delete[] dists;
+		}
+	}
+
+    //! \brief Release the elements and the memory
+	void release() noexcept
+	{
+		if(!m_slots)
+			return;
+		clear();
+		std::allocator<ElT>().deallocate(m_slots, m_mask + 1);
+		delete[] m_dists;
+		m_slots = nullptr;
+		m_dists = nullptr;
+		m_mask = 0;
+	}
+};
+
+//! \brief Open-addressing hash set
+//! \copydetails FlatHashTable
+template <typename KeyT, typename HashT=SolidHash<KeyT>, typename EqualT=std::equal_to<KeyT>>
+class FlatHashSet: public FlatHashTable<KeyT, KeyT, SetKey<KeyT>, HashT, EqualT> {
+	using BaseT = FlatHashTable<KeyT, KeyT, SetKey<KeyT>, HashT, EqualT>;
+public:
+	using BaseT::BaseT;
+
+	//! \brief Constructor from the range of the keys
+	template <typename IterT, typename = std::enable_if_t<!std::is_integral<IterT>::value>>
+	FlatHashSet(IterT begin, IterT end, size_t size=0)
+	: BaseT(size)
+	{
+		for(; begin != end; ++begin)
+			BaseT::insert(*begin);
+	}
+
+	FlatHashSet(std::initializer_list<KeyT> keys)
+	: FlatHashSet(keys.begin(), keys.end(), keys.size())  {}
+
+    //! \brief Insert the key constructed in-place
+	template <typename... Args>
+	pair<typename BaseT::iterator, bool> emplace(Args&&... args)
+	{
+		return BaseT::insert(KeyT(std::forward<Args>(args)...));
+	}
+};
+
+//! \brief Open-addressing hash map
+//! \copydetails FlatHashTable
+//! \note value_type is pair<KeyT, ValT> (the key is not const to be movable
+//! 	between the slots), the key of the stored element must not be modified
+template <typename KeyT, typename ValT, typename HashT=SolidHash<KeyT>, typename EqualT=std::equal_to<KeyT>>
+class FlatHashMap: public FlatHashTable<KeyT, pair<KeyT, ValT>, MapKey<KeyT, ValT>, HashT, EqualT> {
+	using BaseT = FlatHashTable<KeyT, pair<KeyT, ValT>, MapKey<KeyT, ValT>, HashT, EqualT>;
+public:
+	using mapped_type = ValT;
+	using typename BaseT::iterator;
+	using BaseT::BaseT;
+
+    //! \brief Insert the element constructed in-place if the key does not exist
+	template <typename... Args>
+	pair<iterator, bool> emplace(Args&&... args)
+	{
+		return BaseT::insert(pair<KeyT, ValT>(std::forward<Args>(args)...));
+	}
+
+    //! \brief Insert the value constructed in-place if the key does not exist
+    //! \note The value is not constructed if the key exists
+	template <typename... Args>
+	pair<iterator, bool> try_emplace(const KeyT& key, Args&&... args)
+	{
+		auto  it = BaseT::find(key);
+		if(it != BaseT::end())
+			return {it, false};
+		return BaseT::insert(pair<KeyT, ValT>(std::piecewise_construct
+			, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...)));
+	}
+
+	ValT& operator[](const KeyT& key)
+	{
+		return try_emplace(key).first->second;
+	}
+
+	ValT& at(const KeyT& key)
+	{
+		auto  it = BaseT::find(key);
+		if(it == BaseT::end())
+			throw out_of_range("FlatHashMap::at(), the key does not exist\n");
+		return it->second;
+	}
+
+	const ValT& at(const KeyT& key) const
+	{
+		auto  it = BaseT::find(key);
+		if(it == BaseT::end())
+			throw out_of_range("FlatHashMap::at(), the key does not exist\n");
+		return it->second;
+	}
+};
+
+}  // daoc
+
+#endif // FLATHASH_HPP
@@ -20,13 +20,14 @@
 //  	ATTENTNION: results incorrect evaluations on the 32 bit architectures.
 
 #include <string>  // to_string
+#include <cstdint>  // uint64_t
+#include <cstring>  // memset, memcpy
+#include <type_traits>  // conditional_t, is_scalar
 
 #ifdef USE_STL_HASH  // ========================================================
 #include <functional>  // hash
 #else
 //#include <cstddef>  // size_t
-#include <cstring>  // memset
-
 #include "arithmetic.hpp"  // ATTENTNION: must be included before the xxhash; contains ValCRef, CPU_LITTLE_ENDIAN, ...
 
 // Macro definitions using macroses defined in arithmetic ---
@@ -80,6 +81,7 @@ namespace daoc {
 
 using std::string;
 using std::is_scalar;
+using std::conditional_t;
 #ifdef USE_STL_HASH
 using std::hash;
 #endif // USE_STL_HASH
@@ -245,9 +247,95 @@ inline void StreamHash::add<string>(const string& val) noexcept
 	;
 }
 
+// Hashers of the fixed-size values -------------------------------------------
+//! \brief Hasher of the value bytes by xxHash (std::hash if USE_STL_HASH)
+//! \note Applicable for any value, the slowest one for the scalar values
+struct XxHasher {
+    //! \brief Hash the value
+    //!
+    //! \tparam T  - value type
+    //!
+    //! \param val T  - value
+    //! \return size_t  - hash digest
+	template <typename T>
+	static size_t hash(ValCRef<T> val) noexcept
+	{
+		return
+#ifdef USE_STL_HASH
+			std::hash<T>()(val)
+#else
+			XXH_CALL(&val, sizeof val, SEED)
+#endif // USE_STL_HASH
+		;
+	}
+};
+
+//! \brief Bits of the fixed-size value as an unsigned word
+//! \note Pointers, enums and floating point values are represented by their
+//! 	bits, the unused higher bits are zeroized
+//!
+//! \tparam T  - value type of at most 8 bytes
+//!
+//! \param val T  - value
+//! \return uint64_t  - bits of the value
+template <typename T>
+inline uint64_t valueBits(T val) noexcept
+{
+	static_assert(sizeof(T) <= sizeof(uint64_t) && std::is_trivially_copyable<T>::value
+		, "valueBits(), trivially copyable value of at most 8 bytes is expected");
+	uint64_t  bits = 0;
+	memcpy(&bits, &val, sizeof val);  // Note: compiled to a single mov
+	return bits;
+}
+
+//! \brief Hasher of the scalar values (integers, pointers) by the MurmurHash3
+//! finalizer (fmix64)
+//! \note Avalanches all bits, so fits both the prime and power of 2 sized
+//! 	hash tables including aligned pointers with zero lowest bits
+struct FmixHasher {
+	//! \copydoc XxHasher::hash<T>
+	template <typename T>
+	static size_t hash(T val) noexcept
+	{
+		uint64_t  h = valueBits(val);
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdULL;
+		h ^= h >> 33;
+		h *= 0xc4ceb9fe1a85ec53ULL;
+		h ^= h >> 33;
+		return h;
+	}
+};
+
+//! \brief Hasher of the scalar values by the Fibonacci multiplicative
+//! (multiply-shift) hashing
+//! \note The cheapest one; the higher half of the product is folded into the
+//! 	lower one to be applicable for the power of 2 sized hash tables
+struct FibHasher {
+	//! \copydoc XxHasher::hash<T>
+	template <typename T>
+	static size_t hash(T val) noexcept
+	{
+		const uint64_t  h = valueBits(val) * 0x9e3779b97f4a7c15ULL;  // 2^64 / golden ratio
+		return h ^ h >> 32;
+	}
+};
+
+//! \brief Default hasher of the value type: FmixHasher for the scalar values
+//! (arithmetic, enums and pointers) of at most 8 bytes and XxHasher otherwise
+//!
+//! \tparam T  - value type
+template <typename T>
+using DefaultHasher = conditional_t<is_scalar<T>::value && !std::is_member_pointer<T>::value
+	&& sizeof(T) <= sizeof(uint64_t), FmixHasher, XxHasher>;
+
 // SolidHash hash routines -----------------------------------------------------
 //! Value hash
-template <typename T>
+//!
+//! \tparam T  - value type
+//! \tparam HasherT  - hasher policy: XxHasher, FmixHasher, FibHasher or a custom
+//! 	one providing static size_t hash<T>(ValCRef<T> val)
+template <typename T, typename HasherT=DefaultHasher<T>>
 struct SolidHash {
 	// Note: arrays can be multi-dimensional and may contain pointers, compound
 	// objects also may contain pointers, which prevents default any meaningful
@@ -262,19 +350,14 @@ struct SolidHash {
     //! \return size_t  - hash digest
 	size_t operator()(ValCRef<T> val) const noexcept
 	{
-		return
-#ifdef USE_STL_HASH
-			hash<T>()(val)
-#else
-			XXH_CALL(&val, sizeof val, SEED)
-#endif // USE_STL_HASH
-		;
+		return HasherT::template hash<T>(val);
 	}
 };
 
 // SolidHash specializations -----
-template <>
-struct SolidHash<string> {
+//! \note Strings are always hashed by xxHash (std::hash if USE_STL_HASH)
+template <typename HasherT>
+struct SolidHash<string, HasherT> {
     //! \brief Hash the object
     //!
     //! \param val const string&  - object
@@ -31,6 +31,9 @@
 //
 //	- UTEST  - build [also] unit tests, requires installation and linking of the unit test library.
 //
+//	- DAOC_ZLIB, DAOC_ZSTD  - support the gzip / zstd compressed outputs (CompressedFile),
+//		requires linking of the zlib / zstd library respectively.
+//
 // NOTE: undefined maro definition is interpreted as having value 0
 
 #ifndef TRACE
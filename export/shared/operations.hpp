@@ -14,6 +14,7 @@
 #define OPERATIONS_H
 
 #include <cstddef>  // ptrdiff_t
+#include <cstdint>  // uintptr_t
 #include <cmath>  // fabs(), isinf()
 #include <limits>  // Type limits
 #include <type_traits>  // type check, enable_if_t
@@ -22,6 +23,8 @@
 #include <iterator>  // iterator_traits
 #include <stdexcept>  // Exception (for Arguments processing)
 #include <string>  // to_string
+#include <algorithm>  // copy
+#include <chrono>  // steady_clock (binsearch margin calibration)
 
 #include "macrodef.h"  // TRACE, VALIDATE
 
@@ -38,6 +41,8 @@ namespace daoc {
 //  related ordering.
 //	- INSORTED_NONUNIQUE  - insorted() does not validate that the inserting
 //	element is not present
+//	- BINSEARCH_NOCALIBRATE  - use the fixed BINSEARCH_MARGIN in fast_[i]find()
+//	instead of the calibrated one for the current CPU
 //
 // NOTE:
 // - undefined maro definition is interpreted as having value 0
@@ -414,6 +419,7 @@ constexpr bool cmpObjsWeight(typename ObjsT::const_reference a, typename ObjsT::
 
 // Binary search --------------------------------------------------------------
 // Min size of an array when bin search is faster than a linear scan, 11 or 9
+// Note: the default value, fast_[i]find() use binsearchMargin() calibrated for the CPU
 constexpr int  BINSEARCH_MARGIN = 11;
 
 //! \brief Direct value comparison (binary find callback)
@@ -732,6 +738,156 @@ linear_ifind(Container& cnt, const Val val
 	return linear_ifind(cnt.begin(), cnt.end(), val, cmp);
 }
 
+// Branchless search ----------------------------------------------------------
+//! \brief Branchless linear search in the ordered range with random iterators
+//! 	for the closest following element
+//! \note All elements are compared without the early exit, which avoids the
+//! 	branch misprediction and is vectorized by the compiler for the contiguous
+//! 	scalar items (SSE/AVX2/AVX-512 depending on the target architecture)
+//! \pre The elements are ordered by bsVal() and unique.
+//! 	The number of elements is small (typically up to binsearchMargin())
+//!
+//! \tparam RandIT  - random iterator
+//! \tparam Val  - value type
+//! \tparam CompareF  - NONSTANDARD comparison function, see linear_ifind()
+//! \return random iterator of the value position if exists, otherwise
+//! 	the iterator on the following value / end
+template <typename RandIT, typename Val, typename CompareF>
+inline enable_if_t<is_iterator<RandIT, std::random_access_iterator_tag>(), RandIT>
+count_ifind(const RandIT begin, const RandIT end, const Val val
+	, CompareF cmp=bsVal<MemberValCRef<RandIT>>) noexcept
+{
+	static_assert(sizeof(Val) <= sizeof(void*)
+		, "count_ifind(), Val should not exceed the address type size");
+	static_assert(is_same<decltype(cmp(*begin, val)), decltype(bsVal(nullptr, nullptr))>::value
+		, "count_ifind(), cmp() must return the same type as bsVal()");
+	using DiffT = decltype(end - begin);
+	const DiffT  num = end - begin;
+	DiffT  ipos = 0;  // The number of items preceding val
+	for(DiffT i = 0; i < num; ++i)
+		ipos += cmp(begin[i], val) < 0;
+	return begin + ipos;
+}
+
+//! \brief Branchless binary search in the ordered range with random iterators
+//! 	for the closest following element
+//! \note The range is halved by the conditional moves instead of the branching,
+//! 	the number of comparisons is always ceil(log2(num + 1))
+//! \pre The elements are ordered by bsVal() and unique
+//! \post Returned iterator always has not less value than required
+//!
+//! \copydetails count_ifind
+template <typename RandIT, typename Val, typename CompareF>
+inline enable_if_t<is_iterator<RandIT, std::random_access_iterator_tag>(), RandIT>
+branchless_ifind(RandIT begin, const RandIT end, const Val val
+	, CompareF cmp=bsVal<MemberValCRef<RandIT>>) noexcept
+{
+	static_assert(sizeof(Val) <= sizeof(void*)
+		, "branchless_ifind(), Val should not exceed the address type size");
+	static_assert(is_same<decltype(cmp(*begin, val)), decltype(bsVal(nullptr, nullptr))>::value
+		, "branchless_ifind(), cmp() must return the same type as bsVal()");
+	auto  num = end - begin;
+	if(!num)
+		return begin;
+	while(num > 1) {
+		const auto  half = num / 2;
+		begin = cmp(begin[half], val) < 0 ? begin + half : begin;
+		num -= half;
+	}
+	begin += cmp(*begin, val) < 0;
+#if VALIDATE >= 2
+	assert((begin == end || cmp(*begin, val) >= 0)
+	&& "branchless_ifind(), iterator verification failed");
+#endif // VALIDATE
+	return begin;
+}
+
+//! \brief Calibrate the min size of an array when the branchless binary search
+//! 	is faster than the branchless linear scan on the current CPU
+//! \note Evaluated on the links-like items ordered by the address-sized dest
+//! 	in a few milliseconds
+//!
+//! \return int  - calibrated margin, BINSEARCH_MARGIN if the binary search is
+//! 	not faster on any evaluated size
+inline int calibrateBinsearchMargin() noexcept
+{
+	using Clock = std::chrono::steady_clock;
+	//! Evaluation item
+	struct Item {
+		uintptr_t  dest;  //!< Ordering key
+		float  weight;  //!< Payload to have the typical stride
+	};
+	auto  cmp = [](const Item& el, uintptr_t dest) noexcept -> ptrdiff_t {
+		return bsVal(el.dest, dest);
+	};
+
+	constexpr unsigned  ITEMS_MAX = 64;  // Max evaluated size
+	constexpr unsigned  QUERIES = 256;  // The number of distinct queries
+	constexpr unsigned  REPS = 16;  // Repetitions of the queries
+	constexpr unsigned  ROUNDS = 3;  // Timing rounds, the fastest one is taken
+	Item  items[ITEMS_MAX];
+	uintptr_t  queries[QUERIES];
+	for(unsigned i = 0; i < ITEMS_MAX; ++i)
+		items[i] = {(i + 1) * 64, 1};
+	uint32_t  rnd = 0x9e3779b9;  // Seed of the xorshift generator
+	volatile size_t  sink = 0;  // Prevents elimination of the evaluated searches
+	//! Min evaluation time of the searches by the kernel on the first size items
+	auto evaluate = [&](unsigned size, bool binary) noexcept -> Clock::rep {
+		for(auto& q: queries) {
+			rnd ^= rnd << 13;
+			rnd ^= rnd >> 17;
+			rnd ^= rnd << 5;
+			q = rnd % ((size + 1) * 64);
+		}
+		Clock::rep  tmin = numeric_limits<Clock::rep>::max();
+		for(unsigned ir = 0; ir < ROUNDS; ++ir) {
+			size_t  acc = 0;
+			const auto  tstart = Clock::now();
+			for(unsigned irep = 0; irep < REPS; ++irep)
+				for(auto q: queries)
+					acc += (binary ? branchless_ifind(items, items + size, q, cmp)
+						: count_ifind(items, items + size, q, cmp)) - items;
+			const auto  dt = (Clock::now() - tstart).count();
+			sink += acc;
+			if(tmin > dt)
+				tmin = dt;
+		}
+		return tmin;
+	};
+
+	// Take the first size starting from which the binary search is faster
+	// on two subsequent evaluated sizes
+	unsigned  margin = 0;
+	for(unsigned size = 4; size <= ITEMS_MAX; size += 4) {
+		if(evaluate(size, true) < evaluate(size, false)) {
+			if(!margin)
+				margin = size;
+			else break;
+		} else margin = 0;
+	}
+	if(!margin)
+		margin = BINSEARCH_MARGIN;
+#if TRACE >= 2
+	fprintf(ftrace, "calibrateBinsearchMargin(), binsearch margin: %u\n", margin);
+#endif // TRACE
+	return margin;
+}
+
+//! \brief Min size of an array when the binary search is faster than the linear scan
+//! \note Calibrated once on the first call for the current CPU unless
+//! 	BINSEARCH_NOCALIBRATE is defined
+//!
+//! \return int  - binary search margin, >= 1
+inline int binsearchMargin() noexcept
+{
+#ifndef BINSEARCH_NOCALIBRATE
+	static const int  margin = calibrateBinsearchMargin();
+	return margin;
+#else
+	return BINSEARCH_MARGIN;
+#endif // BINSEARCH_NOCALIBRATE
+}
+
 //! Fast index find in the sorted dataset using either binary or linear search
 //! \attention Te returned iterator is not necessary point to the end if the item is not present
 template <typename RandIT, typename Val, typename CompareF>
@@ -741,9 +897,9 @@ fast_ifind(RandIT begin, const RandIT end, const Val val
 {
 	static_assert(sizeof(Val) <= sizeof(void*)
 		, "fast_ifind(), Val should not exceed the address type size");
-	return (end - begin) < BINSEARCH_MARGIN
-		? linear_ifind(begin, end, val, cmp)
-		: binary_ifind(begin, end, val, cmp);
+	return (end - begin) < binsearchMargin()
+		? count_ifind(begin, end, val, cmp)
+		: branchless_ifind(begin, end, val, cmp);
 }
 
 //! Fast index find in the sorted dataset using either binary or linear search
@@ -766,9 +922,8 @@ fast_find(RandIT begin, const RandIT end, const Val val
 {
 	static_assert(sizeof(Val) <= sizeof(void*)
 		, "fast_find(), Val should not exceed the address type size");
-	return (end - begin) < BINSEARCH_MARGIN
-		? linear_find(begin, end, val, cmp)
-		: binary_find(begin, end, val, cmp);
+	RandIT  pos = fast_ifind(begin, end, val, cmp);
+	return pos != end && !cmp(*pos, val) ? pos : end;
 }
 
 //! Fast find in the sorted dataset using either binary or linear search
@@ -849,6 +1004,60 @@ bool sorted(IterT begin, const IterT end
 	return true;
 }
 
+//! \brief Stable LSD radix sort of the items by the unsigned integral key
+//! \note Takes O(n * sizeof(KeyT)) operations. Histograms of all digits are
+//! 	built in a single pass and the byte passes having the same digit for all
+//! 	items are skipped, so the small key ranges take less passes. The relative
+//! 	order of the items having the same key is retained.
+//! \post buf has unspecified content
+//!
+//! \tparam ContainerT  - random access container of the movable, default
+//! 	constructible items
+//! \tparam KeyF  - key of the item: KeyT key(const value_type& item),
+//! 	where KeyT is unsigned integral
+//!
+//! \param els ContainerT&  - items to be sorted
+//! \param buf ContainerT&  - buffer of the items, resized to the size of els
+//! \param key KeyF  - key of the item
+//! \return void
+template <typename ContainerT, typename KeyF>
+void radixSort(ContainerT& els, ContainerT& buf, KeyF key)
+{
+	using KeyT = decltype(key(els.front()));
+	static_assert(std::is_unsigned<KeyT>::value, "radixSort(), KeyT should be unsigned integral");
+	constexpr unsigned  DIGIT_BITS = 8;
+	constexpr size_t  RADIX = 1 << DIGIT_BITS;
+	constexpr unsigned  DIGITS = sizeof(KeyT);
+
+	const size_t  size = els.size();
+	if(size <= 1)
+		return;
+	size_t  hists[DIGITS][RADIX] = {};  // Histograms of the digits
+	for(const auto& el: els) {
+		const KeyT  k = key(el);
+		for(unsigned i = 0; i < DIGITS; ++i)
+			++hists[i][(k >> i * DIGIT_BITS) & (RADIX - 1)];
+	}
+	buf.resize(size);
+	for(unsigned i = 0; i < DIGITS; ++i) {
+		auto&  hist = hists[i];
+		const unsigned  shift = i * DIGIT_BITS;
+		// Skip the digit having the same value for all items
+		if(hist[(key(els.front()) >> shift) & (RADIX - 1)] == size)
+			continue;
+		// Convert the histogram to the offsets
+		size_t  pos = 0;
+		for(auto& num: hist) {
+			const size_t  dnum = num;
+			num = pos;
+			pos += dnum;
+		}
+		for(auto& el: els)
+			buf[hist[(key(el) >> shift) & (RADIX - 1)]++] = std::move(el);
+		els.swap(buf);
+	}
+}
+
 //! \brief Index of the specified element in the sorted elements
 //! \pre Elements are ordered and unique
 //! \note If not INSORTED_NONUNIQUE and VALIDATE >= 1 then the elements are validated
@@ -935,6 +1144,233 @@ inline typename ContainerT::iterator insortedLight(ContainerT& els, const ItemT
 	return iel;
 }
 
+// Sorted sequences -----------------------------------------------------------
+//! \brief Galloping (exponential) search in the ordered range with random
+//! 	iterators for the closest following element
+//! \note Takes O(log(d)) comparisons, where d is the distance of the resulting
+//! 	item from the begin, so it is efficient for the sequential searches of
+//! 	the ordered values. Val is not constrained by the address size.
+//! \pre The elements are ordered by cmp and unique
+//!
+//! \tparam RandIT  - random iterator
+//! \tparam Val  - value type
+//! \tparam CompareF  - NONSTANDARD comparison function, see linear_ifind()
+//! \return random iterator of the value position if exists, otherwise
+//! 	the iterator on the following value / end
+template <typename RandIT, typename Val, typename CompareF>
+enable_if_t<is_iterator<RandIT, std::random_access_iterator_tag>(), RandIT>
+gallop_ifind(RandIT begin, const RandIT end, const Val& val, CompareF cmp) noexcept
+{
+	static_assert(is_same<decltype(cmp(*begin, val)), decltype(bsVal(nullptr, nullptr))>::value
+		, "gallop_ifind(), cmp() must return the same type as bsVal()");
+	using DiffT = decltype(end - begin);
+	const DiffT  size = end - begin;
+	// Find the range [begin + ib, begin + ie) containing the result
+	DiffT  ib = 0;
+	DiffT  ie = 1;
+	while(ie <= size && cmp(begin[ie - 1], val) < 0) {
+		ib = ie;
+		ie *= 2;
+	}
+	if(--ie > size)
+		ie = size;
+	// Branchless binary search in the found range
+	begin += ib;
+	DiffT  num = ie - ib;
+	if(!num)
+		return begin;
+	while(num > 1) {
+		const DiffT  half = num / 2;
+		begin = cmp(begin[half], val) < 0 ? begin + half : begin;
+		num -= half;
+	}
+	return begin + (cmp(*begin, val) < 0);
+}
+
+//! \brief Combination of the matching items of the sequences having unique items
+//! \note Throws invalid_argument on the call
+struct UniqueCombine {
+	template <typename T>
+	T operator()(const T&, const T&) const
+	{ throw invalid_argument("UniqueCombine, the combining sequences should not have common items\n"); }
+};
+
+//! \brief Galloping intersection of the ordered ranges
+//! \note Each head of the shorter remained range is galloped in the longer one,
+//! 	so O(m log(n/m)) comparisons are performed for the m <= n items
+//! \pre The elements of both ranges are of the same type, ordered by cmp and unique
+//!
+//! \tparam RandIT1  - random iterator of the first range
+//! \tparam RandIT2  - random iterator of the second range
+//! \tparam ProcF  - processing of the matching items:
+//! 		void proc(RandIT1::reference item1, RandIT2::reference item2)
+//! \tparam CompareF  - NONSTANDARD comparison function of the items, see bsDest()
+//!
+//! \param begin1 RandIT1  - begin of the first range
+//! \param end1 const RandIT1  - end of the first range
+//! \param begin2 RandIT2  - begin of the second range
+//! \param end2 const RandIT2  - end of the second range
+//! \param proc ProcF  - processing function of the matching items
+//! \param cmp CompareF  - comparison function
+//! \return size_t  - the number of matching items
+template <typename RandIT1, typename RandIT2, typename ProcF, typename CompareF>
+size_t intersectSorted(RandIT1 begin1, const RandIT1 end1, RandIT2 begin2, const RandIT2 end2
+	, ProcF proc, CompareF cmp)
+{
+	static_assert(is_same<typename iterator_traits<RandIT1>::value_type
+		, typename iterator_traits<RandIT2>::value_type>::value
+		, "intersectSorted(), the ranges should have the same value type");
+	size_t  num = 0;  // The number of matching items
+	while(begin1 != end1 && begin2 != end2) {
+		if(end1 - begin1 <= end2 - begin2) {
+			begin2 = gallop_ifind(begin2, end2, *begin1, cmp);
+			if(begin2 == end2)
+				break;
+			if(!cmp(*begin2, *begin1)) {
+				proc(*begin1, *begin2);
+				++num;
+				++begin2;
+			}
+			++begin1;
+		} else {
+			begin1 = gallop_ifind(begin1, end1, *begin2, cmp);
+			if(begin1 == end1)
+				break;
+			if(!cmp(*begin1, *begin2)) {
+				proc(*begin1, *begin2);
+				++num;
+				++begin1;
+			}
+			++begin2;
+		}
+	}
+	return num;
+}
+
+//! \brief Merge-union of the ordered ranges combining the matching items
+//! \note The ranges of comparable sizes are merged item by item, otherwise the
+//! 	runs of the longer range between the items of the shorter one are located
+//! 	by the galloping search and copied in bulk (memmove for the trivially
+//! 	copyable items), which takes O(m log(n/m)) comparisons for the m << n items
+//! \pre The elements of both ranges are of the same type, ordered by cmp and unique
+//! \post The output items are ordered by cmp and unique
+//!
+//! \tparam RandIT1  - random iterator of the first range
+//! \tparam RandIT2  - random iterator of the second range
+//! \tparam OutIT  - output iterator
+//! \tparam CompareF  - NONSTANDARD comparison function of the items, see bsDest()
+//! \tparam CombineF  - combination of the matching items:
+//! 		value_type combine(const value_type& item1, const value_type& item2),
+//! 		for example accumulating the weight of the links
+//!
+//! \param begin1 RandIT1  - begin of the first range
+//! \param end1 const RandIT1  - end of the first range
+//! \param begin2 RandIT2  - begin of the second range
+//! \param end2 const RandIT2  - end of the second range
+//! \param out OutIT  - output iterator
+//! \param cmp CompareF  - comparison function
+//! \param combine=CombineF() CombineF  - combination of the matching items
+//! \return OutIT  - output iterator past the last outputted item
+template <typename RandIT1, typename RandIT2, typename OutIT, typename CompareF
+	, typename CombineF=UniqueCombine>
+OutIT mergeSorted(RandIT1 begin1, const RandIT1 end1, RandIT2 begin2, const RandIT2 end2
+	, OutIT out, CompareF cmp, CombineF combine=CombineF())
+{
+	static_assert(is_same<typename iterator_traits<RandIT1>::value_type
+		, typename iterator_traits<RandIT2>::value_type>::value
+		, "mergeSorted(), the ranges should have the same value type");
+	// Min ratio of the range sizes to apply the galloping merge
+	constexpr ptrdiff_t  GALLOP_RATIO = 8;
+
+	const ptrdiff_t  size1 = end1 - begin1;
+	const ptrdiff_t  size2 = end2 - begin2;
+	if(size1 >= size2 * GALLOP_RATIO) {
+		for(; begin2 != end2; ++begin2) {
+			const auto  ie = gallop_ifind(begin1, end1, *begin2, cmp);
+			out = std::copy(begin1, ie, out);
+			begin1 = ie;
+			if(begin1 != end1 && !cmp(*begin1, *begin2))
+				*out++ = combine(*begin1++, *begin2);
+			else *out++ = *begin2;
+		}
+	} else if(size2 >= size1 * GALLOP_RATIO) {
+		for(; begin1 != end1; ++begin1) {
+			const auto  ie = gallop_ifind(begin2, end2, *begin1, cmp);
+			out = std::copy(begin2, ie, out);
+			begin2 = ie;
+			if(begin2 != end2 && !cmp(*begin2, *begin1))
+				*out++ = combine(*begin1, *begin2++);
+			else *out++ = *begin1;
+		}
+	} else while(begin1 != end1 && begin2 != end2) {
+		const auto  res = cmp(*begin1, *begin2);
+		if(res < 0)
+			*out++ = *begin1++;
+		else if(res > 0)
+			*out++ = *begin2++;
+		else *out++ = combine(*begin1++, *begin2++);
+	}
+	out = std::copy(begin1, end1, out);
+	return std::copy(begin2, end2, out);
+}
+
+//! \brief Insert the ordered run of items into the ordered elements
+//! 	combining the matching items
+//! \note The matching items are located by the galloping intersection, then
+//! 	the elements are extended and merged with the run in place from the back,
+//! 	so only the elements following the first inserted item are moved once
+//! 	instead of O(m) insertions with O(m log n) searches by insorted()
+//! \pre The elements and the run items are ordered by cmp and unique.
+//! 	The value type is default constructible.
+//! \post The elements are ordered by cmp and unique
+//!
+//! \tparam ContainerT  - random access container type
+//! \tparam RandIT  - random iterator of the run
+//! \tparam CompareF  - NONSTANDARD comparison function of the items, see bsDest()
+//! \tparam CombineF  - combination of the matching items, see mergeSorted()
+//!
+//! \param els ContainerT&  - elements to be extended
+//! \param begin RandIT  - begin of the run
+//! \param end const RandIT  - end of the run
+//! \param cmp CompareF  - comparison function
+//! \param combine=CombineF() CombineF  - combination of the matching items
+//! \return size_t  - the number of inserted items (excluding the combined ones)
+template <typename ContainerT, typename RandIT, typename CompareF, typename CombineF=UniqueCombine>
+size_t insortedRun(ContainerT& els, const RandIT begin, RandIT end, CompareF cmp
+	, CombineF combine=CombineF())
+{
+#if VALIDATE >= 2
+	assert((begin == end || sorted(begin, end, cmp)) && "insortedRun(), the run should be sorted");
+#endif // VALIDATE
+#if VALIDATE >= 3
+	assert((els.empty() || sorted(els.begin(), els.end(), cmp))
+		&& "insortedRun(), the elements should be sorted");
+#endif // VALIDATE
+	using Item = typename ContainerT::value_type;
+	const size_t  ndups = intersectSorted(els.begin(), els.end(), begin, end
+		, [&combine](Item& el, const Item& rel) { el = combine(el, rel); }, cmp);
+	const size_t  num = (end - begin) - ndups;  // The number of inserting items
+	if(!num)
+		return 0;
+	size_t  iold = els.size();
+	els.resize(iold + num);
+	const auto  iels = els.begin();
+	// Merge from the back skipping the already combined items of the run
+	for(size_t inew = els.size(); inew != iold;) {
+		const auto&  rel = *(end - 1);
+		const auto  res = iold ? cmp(iels[iold - 1], rel) : -1;
+		if(res >= 0) {
+			iels[--inew] = std::move(iels[--iold]);
+			if(!res)
+				--end;
+		} else {
+			iels[--inew] = rel;
+			--end;
+		}
+	}
+	return num;
+}
+
 //! \brief Find min value among the specified arguments of the same type
 //!
 //! \param val ValT  - first argument
@@ -0,0 +1,132 @@
+//! \brief Parallel processing utilities.
+//!
+//! \license Apache License, Version 2.0: http://www.apache.org/licenses/LICENSE-2.0.html
+//! > 	Simple explanation: https://tldrlegal.com/license/apache-license-2.0-(apache-2.0)
+//!
+//! Copyright (c)
+//! \authr Artem Lutov
+//! \email luart@ya.ru
+//! \date 2026-10-16
+
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <cstddef>  // size_t
+#include <thread>
+#include <vector>
+#include <exception>  // exception_ptr
+#include <algorithm>  // min
+
+
+namespace daoc {
+
+using std::thread;
+using std::vector;
+using std::exception_ptr;
+
+//! \brief The number of workers to process the items in parallel
+//!
+//! \param items size_t  - the number of items to be processed
+//! \param minitems=1 size_t  - min number of items per worker, >= 1
+//! \param workers=0 unsigned  - max number of workers, 0 means the number of
+//! 	the hardware threads
+//! \return unsigned  - the number of workers, >= 1
+inline unsigned workersNum(size_t items, size_t minitems=1, unsigned workers=0) noexcept
+{
+	if(!workers) {
+		workers = thread::hardware_concurrency();
+		if(!workers)
+			workers = 1;
+	}
+	if(!minitems)
+		minitems = 1;
+	return std::max<size_t>(std::min<size_t>(workers, items / minitems), 1);
+}
+
+//! \brief Process the range of items in parallel by contiguous subranges
+//! \note The first subrange is processed by the calling thread. Exceptions
+//! 	of the workers are rethrown after the completion of all workers, the one
+//! 	of the lowest subrange is rethrown.
+//!
+//! \tparam ProcF  - processing function: void (size_t ib, size_t ie, unsigned iw),
+//! 	where [ib, ie) is the processing subrange and iw is the worker index
+//!
+//! \param size size_t  - the number of items to be processed
+//! \param proc ProcF&&  - processing function
+//! \param workers unsigned  - the number of workers (subranges), >= 1
+//! \return void
+template <typename ProcF>
+void parallelRanges(size_t size, ProcF&& proc, unsigned workers)
+{
+	if(workers <= 1 || size <= 1) {
+		proc(0, size, 0);
+		return;
+	}
+	if(workers > size)
+		workers = size;
+	vector<exception_ptr>  errs(workers);
+	vector<thread>  thrs;
+	thrs.reserve(workers - 1);
+	//! Process the subrange capturing the exception
+	auto process = [size, workers, &proc, &errs](unsigned iw) noexcept {
+		try {
+			proc(size * iw / workers, size * (iw + 1) / workers, iw);
+		} catch(...) {
+			errs[iw] = std::current_exception();
+		}
+	};
+	try {
+		for(unsigned iw = 1; iw < workers; ++iw)
+			thrs.emplace_back(process, iw);
+	} catch(...) {
+		// Note: the started threads should be joined before the destruction
+		for(auto& thr: thrs)
+			thr.join();
+		throw;
+	}
+	process(0);
+	for(auto& thr: thrs)
+		thr.join();
+	for(auto& err: errs)
+		if(err)
+			std::rethrow_exception(err);
+}
+
+//! \brief Deterministic parallel reduction of the range of items
+//! \note The range is split into the fixed blocks independently of the number
+//! 	of workers, the partial values of the blocks are combined by the pairwise
+//! 	(tree) reduction. So the result is bit-identical for any number of workers
+//! 	and more accurate than the sequential accumulation of floating point values.
+//!
+//! \tparam ValT  - accumulated value type supporting operator+=
+//! \tparam BlockF  - block accumulating function: ValT (size_t ib, size_t ie),
+//! 	where [ib, ie) is the accumulating block
+//!
+//! \param size size_t  - the number of items to be processed
+//! \param blockf BlockF&&  - block accumulating function
+//! \param workers unsigned  - the number of workers, >= 1
+//! \param block=1024 size_t  - the number of items in a block, >= 1
+//! \return ValT  - accumulated value, ValT() for the empty range
+template <typename ValT, typename BlockF>
+ValT parallelReduce(size_t size, BlockF&& blockf, unsigned workers, size_t block=1024)
+{
+	if(!size)
+		return ValT();
+	if(!block)
+		block = 1;
+	const size_t  blocks = (size + block - 1) / block;
+	vector<ValT>  parts(blocks);
+	parallelRanges(blocks, [&](size_t ib, size_t ie, unsigned) {
+		for(; ib < ie; ++ib)
+			parts[ib] = blockf(ib * block, std::min(ib * block + block, size));
+	}, workers);
+	// Pairwise reduction of the partial values
+	for(size_t step = 1; step < blocks; step *= 2)
+		for(size_t i = 0; i + step < blocks; i += 2 * step)
+			parts[i] += parts[i + step];
+	return parts.front();
+}
+
+}  // daoc
+
+#endif // PARALLEL_HPP
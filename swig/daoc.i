@@ -72,6 +72,8 @@ StoredItems<Node<WeightedLinks>>
 //! Transparent  shared_ptr for the RawMembership
 %shared_ptr(RawMembership<false>);  // ! Has the same effect as %shared_ptr(SRawMembership)
 %shared_ptr(RawMembership<true>);  // ! Has the same effect as %shared_ptr(SRawMembership)
+//! Transparent shared_ptr for the flat hierarchy, which owns the exported arrays
+%shared_ptr(FlatHierarchy);
 ////%unique_ptr(RawMembership<>);
 
 %{
@@ -147,6 +149,57 @@ StoredItems<Node<WeightedLinks>>
 //%feature("nspace") MyWorld::Material::Color;
 
 %import "macrodef.h"  // Apply macro definitions, but do not make wrappers for them
+#ifdef SWIGPYTHON
+%{
+//! \brief Release of the Python GIL in the scope
+//! \note Python objects should not be accessed in the scope
+class PyGilRelease {
+	PyThreadState*  m_state;  //!< Saved thread state
+public:
+	PyGilRelease(): m_state(PyEval_SaveThread())  {}
+	PyGilRelease(const PyGilRelease&)=delete;
+	PyGilRelease& operator=(const PyGilRelease&)=delete;
+	~PyGilRelease()  { PyEval_RestoreThread(m_state); }
+};
+%}
+
+// Heavy native calls release the GIL, so the other Python threads (including
+// other clusterings) proceed meanwhile. The GIL is restored before the error
+// translation.
+// ATTENTION: the arguments (graph, nodes, hierarchy) should not be accessed by
+// the other threads until the call completion.
+%define NOGIL_CALL(func)
+%exception func {
+	try {
+		PyGilRelease  nogil;
+		$action
+	} catch(const std::invalid_argument& err) {
+		SWIG_exception(SWIG_ValueError, err.what());
+	} catch(const std::out_of_range& err) {
+		SWIG_exception(SWIG_IndexError, err.what());
+	} catch(const std::exception& err) {
+		SWIG_exception(SWIG_RuntimeError, err.what());
+	}
+}
+%enddef
+
+NOGIL_CALL(daoc::cluster);
+NOGIL_CALL(daoc::intrinsicMeasures);
+NOGIL_CALL(daoc::Graph::buildHierarchy);
+NOGIL_CALL(daoc::Hierarchy::output);
+NOGIL_CALL(daoc::NslParser::build);
+NOGIL_CALL(daoc::RcgParser::build);
+NOGIL_CALL(daoc::CnlParser::build);
+NOGIL_CALL(daoc::CnbParser::build);
+NOGIL_CALL(daoc::flatten);
+// Waiting for the asynchronous clustering, including the destruction of the
+// last handle of the running clustering
+NOGIL_CALL(daoc::ClusteringTask::ClusteringTask);
+NOGIL_CALL(daoc::ClusteringTask::~ClusteringTask);
+NOGIL_CALL(daoc::ClusteringTask::wait);
+NOGIL_CALL(daoc::ClusteringTask::get);
+#endif  // SWIGPYTHON
+
 %include "flags.h"
 %include "types.h"
 %include "functionality.h"
@@ -157,8 +210,10 @@ StoredItems<Node<WeightedLinks>>
 %include "fileio/parser_rcg.h"
 %include "fileio/parser_nsl.h"
 %include "fileio/parser_cnl.h"
+%include "fileio/parser_cnb.h"
 %include "fileio/printer_cnl.h"
 %include "fileio/printer_rhb.h"
+%include "fileio/flathier.h"
 
 
 // ATTENTION: SWIG does not recognize template aliases in the interface, macroses
@@ -228,6 +283,8 @@ using namespace daoc;
 %template(InpLinks) Items<InpLink<true>>;
 
 %template(Ids) Items<Id>;
+%template(Sizes) Items<Size>;
+%template(Shares) Items<Share>;
 
 // Wrap member template functions of the Graph
 %extend daoc::Graph {
@@ -248,6 +305,272 @@ using namespace daoc;
 	%template(addEdge) addLink<false>;
 }
 
+#ifdef SWIGPYTHON
+%{
+#include <cstring>  // strchr
+#include <type_traits>  // is_floating_point, is_signed
+
+//! \brief Readonly view of the contiguous 1-D Python buffer (NumPy array,
+//! 	array.array, memoryview) having the specified item type
+//! \note The data are not copied, the buffer is held until the view destruction
+//!
+//! \tparam T  - item type
+template <typename T>
+class PyBufView {
+	Py_buffer  m_view;  //!< Underlying buffer
+	bool  m_held;  //!< The buffer is held
+
+    //! \brief Whether the buffer items have the type T
+    //!
+    //! \return bool  - the items are compatible
+	bool compatible() const noexcept
+	{
+		if(m_view.ndim > 1 || m_view.itemsize != sizeof(T))
+			return false;
+		const char*  fmt = m_view.format ? m_view.format : "B";
+		// Note: only the native byte order is accepted
+		if(*fmt == '@' || *fmt == '='
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+		|| *fmt == '<'
+#else
+		|| *fmt == '>' || *fmt == '!'
+#endif // __BYTE_ORDER__
+		)
+			++fmt;
+		return *fmt && !fmt[1] && strchr(std::is_floating_point<T>::value ? "efd"
+			: std::is_signed<T>::value ? "bhilqn" : "BHILQN", *fmt);
+	}
+public:
+    //! \brief PyBufView constructor
+    //!
+    //! \param obj PyObject*  - object supporting the buffer protocol, None or
+    //! 	nullptr for the empty view
+    //! \param name const char*  - name of the argument to be reported on errors
+	PyBufView(PyObject* obj, const char* name): m_view(), m_held(false)
+	{
+		if(!obj || obj == Py_None)
+			return;
+		if(PyObject_GetBuffer(obj, &m_view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT)) {
+			PyErr_Clear();
+			throw invalid_argument(string("PyBufView(), a contiguous buffer is expected: ")
+				.append(name) += '\n');
+		}
+		if(!compatible()) {
+			PyBuffer_Release(&m_view);
+			throw invalid_argument(string("PyBufView(), a 1-D array of ")
+				.append(std::is_floating_point<T>::value ? "float"
+					: std::is_signed<T>::value ? "int" : "uint")
+				.append(std::to_string(sizeof(T) * 8)).append(" items is expected: ")
+				.append(name) += '\n');
+		}
+		m_held = true;
+	}
+
+	PyBufView(const PyBufView&)=delete;
+	PyBufView& operator=(const PyBufView&)=delete;
+
+	~PyBufView()
+	{
+		if(m_held)
+			PyBuffer_Release(&m_view);
+	}
+
+    //! \brief Items of the buffer
+    //!
+    //! \return const T*  - items or nullptr for the empty view
+	const T* data() const noexcept
+	{ return m_held ? static_cast<const T*>(m_view.buf) : nullptr; }
+
+    //! \brief The number of items
+    //!
+    //! \return size_t  - the number of items
+	size_t size() const noexcept
+	{ return m_held ? m_view.len / sizeof(T) : 0; }
+};
+
+//! \brief Readonly 1-D buffer exporting the array owned by the shared object
+//! \note The owner is retained while any view of the buffer (memoryview,
+//! 	NumPy array) exists, so the data are never copied
+struct PySharedBuf {
+	PyObject_HEAD
+	shared_ptr<const void>  owner;  //!< Owner of the data
+	const void*  data;  //!< Items
+	Py_ssize_t  size;  //!< The number of items
+	Py_ssize_t  itemsize;  //!< Size of the item in bytes
+	const char*  format;  //!< Item format in the struct module syntax
+};
+
+static int pySharedBufGet(PyObject* obj, Py_buffer* view, int flags)
+{
+	auto  sbuf = reinterpret_cast<PySharedBuf*>(obj);
+	if(flags & PyBUF_WRITABLE) {
+		PyErr_SetString(PyExc_BufferError, "pySharedBufGet(), the buffer is readonly");
+		view->obj = nullptr;
+		return -1;
+	}
+	// Note: the empty buffer should still have a valid address
+	static const char  dummy = 0;
+	view->buf = const_cast<void*>(sbuf->size ? sbuf->data : &dummy);
+	view->obj = obj;
+	Py_INCREF(obj);
+	view->len = sbuf->size * sbuf->itemsize;
+	view->readonly = 1;
+	view->itemsize = sbuf->itemsize;
+	view->format = flags & PyBUF_FORMAT ? const_cast<char*>(sbuf->format) : nullptr;
+	view->ndim = 1;
+	view->shape = flags & PyBUF_ND ? &sbuf->size : nullptr;
+	view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? &sbuf->itemsize : nullptr;
+	view->suboffsets = nullptr;
+	view->internal = nullptr;
+	return 0;
+}
+
+static void pySharedBufDealloc(PyObject* obj)
+{
+	reinterpret_cast<PySharedBuf*>(obj)->owner.~shared_ptr();
+	Py_TYPE(obj)->tp_free(obj);
+}
+
+//! \brief Python type of the shared buffer, initialized on the first call
+//!
+//! \return PyTypeObject*  - the type or nullptr on failure
+static PyTypeObject* pySharedBufType()
+{
+	static PyBufferProcs  procs = {pySharedBufGet, nullptr};
+	static PyTypeObject  type = {PyVarObject_HEAD_INIT(nullptr, 0)};
+	if(!type.tp_name) {
+		type.tp_name = "daoc.SharedBuffer";
+		type.tp_basicsize = sizeof(PySharedBuf);
+		type.tp_dealloc = pySharedBufDealloc;
+		type.tp_as_buffer = &procs;
+		type.tp_flags = Py_TPFLAGS_DEFAULT;
+		type.tp_doc = "Readonly buffer of the array owned by the native object";
+		if(PyType_Ready(&type)) {
+			type.tp_name = nullptr;
+			return nullptr;
+		}
+	}
+	return &type;
+}
+
+//! \brief Readonly memoryview of the items owned by the shared object
+//!
+//! \tparam T  - item type
+//! \param owner shared_ptr<const void>  - owner of the items
+//! \param items const Items<T>&  - items to be exported without copying
+//! \return PyObject*  - memoryview or nullptr on failure with the Python error set
+template <typename T>
+PyObject* pySharedItems(shared_ptr<const void> owner, const Items<T>& items)
+{
+	static_assert(sizeof(T) == 4 || sizeof(T) == 8, "pySharedItems(), unexpected item size");
+	PyTypeObject*  type = pySharedBufType();
+	if(!type)
+		return nullptr;
+	PySharedBuf*  sbuf = PyObject_New(PySharedBuf, type);
+	if(!sbuf)
+		return nullptr;
+	new(&sbuf->owner) shared_ptr<const void>(std::move(owner));
+	sbuf->data = items.data();
+	sbuf->size = items.size();
+	sbuf->itemsize = sizeof(T);
+	sbuf->format = std::is_floating_point<T>::value ? (sizeof(T) == 4 ? "f" : "d")
+		: sizeof(T) == 4 ? (std::is_signed<T>::value ? "i" : "I")
+		: std::is_signed<T>::value ? "q" : "Q";
+	PyObject*  res = PyMemoryView_FromObject(reinterpret_cast<PyObject*>(sbuf));
+	Py_DECREF(sbuf);
+	return res;
+}
+%}
+
+%catches(std::invalid_argument, std::out_of_range) daoc::Graph::addArcs;
+%catches(std::invalid_argument, std::out_of_range) daoc::Graph::addEdges;
+%catches(std::invalid_argument, std::out_of_range) daoc::Graph::addCsrArcs;
+%catches(std::invalid_argument, std::out_of_range) daoc::Graph::addCsrEdges;
+
+// Bulk links addition from the arrays (NumPy, array.array, memoryview) consumed
+// via the buffer protocol without copying.
+// Item types: ids - uint32, weights - float32 (LinkWeight), indptr - uint64 (Size).
+// Note: SciPy CSR int32 indices can be passed as indices.view(numpy.uint32).
+%extend daoc::Graph {
+	//! Add arcs specified by the arrays of the src ids, dest ids and optional weights
+	void addArcs(PyObject* srcs, PyObject* dsts, PyObject* weights=nullptr)
+	{
+		const PyBufView<Id>  bsrcs(srcs, "srcs");
+		const PyBufView<Id>  bdsts(dsts, "dsts");
+		const PyBufView<LinkWeight>  bweights(weights, "weights");
+		if(bsrcs.size() != bdsts.size() || (bweights.data() && bweights.size() != bsrcs.size()))
+			throw invalid_argument("addArcs(), the arrays should have the same size\n");
+		$self->addLinks<true>(bsrcs.data(), bdsts.data(), bweights.data(), bsrcs.size());
+	}
+
+	//! Add edges specified by the arrays of the src ids, dest ids and optional weights
+	void addEdges(PyObject* srcs, PyObject* dsts, PyObject* weights=nullptr)
+	{
+		const PyBufView<Id>  bsrcs(srcs, "srcs");
+		const PyBufView<Id>  bdsts(dsts, "dsts");
+		const PyBufView<LinkWeight>  bweights(weights, "weights");
+		if(bsrcs.size() != bdsts.size() || (bweights.data() && bweights.size() != bsrcs.size()))
+			throw invalid_argument("addEdges(), the arrays should have the same size\n");
+		$self->addLinks<false>(bsrcs.data(), bdsts.data(), bweights.data(), bsrcs.size());
+	}
+
+	//! Add arcs specified by the adjacency matrix in the CSR format
+	void addCsrArcs(PyObject* indptr, PyObject* indices, PyObject* weights=nullptr)
+	{
+		const PyBufView<Size>  bindptr(indptr, "indptr");
+		const PyBufView<Id>  bindices(indices, "indices");
+		const PyBufView<LinkWeight>  bweights(weights, "weights");
+		if(!bindptr.size() || bindptr.data()[bindptr.size() - 1] != bindices.size()
+		|| (bweights.data() && bweights.size() != bindices.size()))
+			throw invalid_argument("addCsrArcs(), the arrays sizes are inconsistent\n");
+		$self->addCsrLinks<true>(bindptr.data(), bindptr.size() - 1, bindices.data(), bweights.data());
+	}
+
+	//! Add edges specified by the adjacency matrix in the CSR format
+	void addCsrEdges(PyObject* indptr, PyObject* indices, PyObject* weights=nullptr)
+	{
+		const PyBufView<Size>  bindptr(indptr, "indptr");
+		const PyBufView<Id>  bindices(indices, "indices");
+		const PyBufView<LinkWeight>  bweights(weights, "weights");
+		if(!bindptr.size() || bindptr.data()[bindptr.size() - 1] != bindices.size()
+		|| (bweights.data() && bweights.size() != bindices.size()))
+			throw invalid_argument("addCsrEdges(), the arrays sizes are inconsistent\n");
+		$self->addCsrLinks<false>(bindptr.data(), bindptr.size() - 1, bindices.data(), bweights.data());
+	}
+}
+
+%catches(std::out_of_range) daoc::FlatHierarchy::ids;
+%catches(std::out_of_range) daoc::FlatHierarchy::offsets;
+%catches(std::out_of_range) daoc::FlatHierarchy::members;
+%catches(std::out_of_range) daoc::FlatHierarchy::shares;
+%catches(std::out_of_range) daoc::FlatHierarchy::parents;
+
+// Arrays of the flat hierarchy level as readonly memoryviews without copying,
+// numpy.asarray() of them yields zero-copy NumPy arrays retaining the flat hierarchy.
+// Item types: ids, members, parents - uint32 (Id), offsets - uint64 (Size), shares - float32 (Share).
+%extend daoc::FlatHierarchy {
+	//! Cluster ids of the level
+	PyObject* ids(LevelNum ilev) const
+	{ return pySharedItems($self->shared_from_this(), $self->level(ilev).ids); }
+
+	//! Offsets of the cluster members of the level, clusters + 1 items
+	PyObject* offsets(LevelNum ilev) const
+	{ return pySharedItems($self->shared_from_this(), $self->level(ilev).offsets); }
+
+	//! Member node ids of the level clusters
+	PyObject* members(LevelNum ilev) const
+	{ return pySharedItems($self->shared_from_this(), $self->level(ilev).members); }
+
+	//! Shares of the member nodes in the level clusters
+	PyObject* shares(LevelNum ilev) const
+	{ return pySharedItems($self->shared_from_this(), $self->level(ilev).shares); }
+
+	//! Indexes of the level cluster owners on the next level
+	PyObject* parents(LevelNum ilev) const
+	{ return pySharedItems($self->shared_from_this(), $self->level(ilev).parents); }
+}
+#endif  // SWIGPYTHON
+
 // ATTENTION: The template should be declared before any of it's specializations
 // are used anywhere (including being used as arguments to the shared_ptr<>).
 //! Graph specifying the input network
@@ -362,6 +685,13 @@ using namespace daoc;
 //! Cluster nodes having weighted links yielding the hierarchy of clusters
 %template(cluster) cluster<WeightedLinks>;
 
+//! Asynchronous clustering of nodes having simple links
+// Note: the Python binding releases the GIL on the clustering, so several
+// clusterings run concurrently:  task = SClusteringTask(nodes, True);  hier = task.get()
+%template(SClusteringTask) ClusteringTask<SimpleLinks>;
+//! Asynchronous clustering of nodes having weighted links
+%template(ClusteringTask) ClusteringTask<WeightedLinks>;
+
 // ATTENTION: Hierarchy template should be declared before that template specializations
 // are used anywhere else (including being used as arguments to the shared_ptr<>).
 //! Hierarchy of clusters for nodes with simple links
@@ -426,6 +756,10 @@ using namespace daoc;
 %template(sbuild) CnlParser::build<SimpleLinks>;
 %template(build) CnlParser::build<WeightedLinks>;
 
+//! Build nodes membership from the clustering file having CNB (binary) format
+%template(sbuild) CnbParser::build<SimpleLinks>;
+%template(build) CnbParser::build<WeightedLinks>;
+
 //! Clustering printer used to output the resulting level(s) of clusters hierarchy in the CNL format
 //template <typename LinksT> class CnlPrinter;
 %template(SCnlPrinter) CnlPrinter<SimpleLinks>;
@@ -436,10 +770,17 @@ using namespace daoc;
 %template(SRhbPrinter) RhbPrinter<SimpleLinks>;
 %template(RhbPrinter) RhbPrinter<WeightedLinks>;
 
+//! Flatten the hierarchy into the per-level arrays of the membership
+//template <typename LinksT> shared_ptr<FlatHierarchy> flatten;
+%template(sflatten) flatten<SimpleLinks>;
+%template(flatten) flatten<WeightedLinks>;
+
 //! Load clusters from the file
 //template <typename ParserT, typename GraphT> AccWeight loadClusters;
 %template(sloadClusters) loadClusters<CnlParser, Graph<false>>;
 %template(loadClusters) loadClusters<CnlParser, Graph<true>>;
+%template(sloadCnbClusters) loadClusters<CnbParser, Graph<false>>;
+%template(loadCnbClusters) loadClusters<CnbParser, Graph<true>>;
 
 // Accessory Functions ---------------------------------------------------------
 // template <typename LinksT> struct AccLink;